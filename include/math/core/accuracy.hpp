@@ -0,0 +1,22 @@
+#ifndef MATH_CORE_ACCURACY_HPP
+#define MATH_CORE_ACCURACY_HPP
+
+#include <concepts>
+
+namespace math::accuracy {
+
+// Accuracy tiers for special functions, passed as a trailing tag argument.
+//   fast     short fits (errors around 1e-7), cheap and branch-free
+//   precise  full working precision, within a few ulps for double
+struct fast_t {};
+struct precise_t {};
+
+inline constexpr fast_t fast{};
+inline constexpr precise_t precise{};
+
+template<typename A>
+concept AccuracyPolicy = std::same_as<A, fast_t> || std::same_as<A, precise_t>;
+
+}
+
+#endif
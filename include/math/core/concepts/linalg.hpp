@@ -1,6 +1,7 @@
 #ifndef MATH_CORE_CONCEPTS_LINALG_HPP
 #define MATH_CORE_CONCEPTS_LINALG_HPP
 
+#include <concepts>
 #include <cstddef>
 
 namespace math::concepts {
@@ -21,6 +22,27 @@ concept VectorLike = requires(V v) {
     { v[std::size_t{}] };
 };
 
+template<typename Op>
+concept LinearOperator = requires(const Op& op, const typename Op::vector_type& x) {
+    typename Op::value_type;
+    { op.rows() } -> std::convertible_to<std::size_t>;
+    { op.cols() } -> std::convertible_to<std::size_t>;
+    { op.apply(x) } -> std::convertible_to<typename Op::vector_type>;
+    { op.apply_transpose(x) } -> std::convertible_to<typename Op::vector_type>;
+};
+
+template<typename Op>
+concept DiagonalOperator = LinearOperator<Op> && requires(const Op& op) {
+    { op.diagonal() } -> std::convertible_to<typename Op::vector_type>;
+};
+
+// Operators that can report whether they are symmetric, which lets solvers
+// pick a symmetric Krylov method over one on the normal equations.
+template<typename Op>
+concept SymmetryAwareOperator = LinearOperator<Op> && requires(const Op& op) {
+    { op.symmetric() } -> std::convertible_to<bool>;
+};
+
 }
 
 #endif
@@ -0,0 +1,65 @@
+#ifndef MATH_CORE_CONSTEXPR_MATH_HPP
+#define MATH_CORE_CONSTEXPR_MATH_HPP
+
+namespace math::detail {
+
+// Elementary functions in long double, usable in constant expressions for
+// building coefficient tables. Slow, and only accurate to about 1e-18
+// relative; never call them at run time.
+
+// log x for x > 0: reduce to m in [1/sqrt2, sqrt2] by halving or doubling,
+// then 2 atanh((m-1)/(m+1)).
+constexpr long double constexpr_log(long double x) {
+    constexpr long double ln2 = 0.693147180559945309417232121458176568L;
+    constexpr long double sqrt2 = 1.41421356237309504880168872420969808L;
+    int e = 0;
+    while (x >= 2.0L) { x *= 0.5L; ++e; }
+    while (x < 1.0L) { x *= 2.0L; --e; }
+    if (x > sqrt2) { x *= 0.5L; ++e; }
+    long double f = (x - 1.0L) / (x + 1.0L);
+    long double f2 = f * f;
+    long double power = f;
+    long double sum = 0.0L;
+    for (int k = 0; k < 40; ++k) {
+        sum += power / static_cast<long double>(2 * k + 1);
+        power *= f2;
+    }
+    return static_cast<long double>(e) * ln2 + 2.0L * sum;
+}
+
+// e^x for |x| below about 11000: x = n ln2 + r with |r| <= ln2 / 2, Taylor
+// series for e^r, then n exact doublings or halvings.
+constexpr long double constexpr_exp(long double x) {
+    constexpr long double ln2 = 0.693147180559945309417232121458176568L;
+    long double t = x / ln2;
+    int n = static_cast<int>(t < 0.0L ? t - 0.5L : t + 0.5L);
+    long double r = x - static_cast<long double>(n) * ln2;
+    long double term = 1.0L;
+    long double sum = 1.0L;
+    for (int k = 1; k < 30; ++k) {
+        term *= r / static_cast<long double>(k);
+        sum += term;
+    }
+    for (; n > 0; --n) { sum *= 2.0L; }
+    for (; n < 0; ++n) { sum *= 0.5L; }
+    return sum;
+}
+
+// sqrt x for x >= 0: scale into [1, 4) by powers of four, then Newton.
+constexpr long double constexpr_sqrt(long double x) {
+    if (x <= 0.0L) {
+        return 0.0L;
+    }
+    long double scale = 1.0L;
+    while (x >= 4.0L) { x *= 0.25L; scale *= 2.0L; }
+    while (x < 1.0L) { x *= 4.0L; scale *= 0.5L; }
+    long double y = 0.5L * (x + 1.0L);
+    for (int k = 0; k < 8; ++k) {
+        y = 0.5L * (y + x / y);
+    }
+    return y * scale;
+}
+
+}
+
+#endif
@@ -32,6 +32,10 @@ public:
         return data_[i * Cols + j];
     }
 
+    // Row-major storage, Rows * Cols contiguous elements.
+    constexpr T* data() { return data_.data(); }
+    constexpr const T* data() const { return data_.data(); }
+
     static constexpr Matrix identity() requires (Rows == Cols) {
         Matrix result;
         for (std::size_t i = 0; i < Rows; ++i) {
@@ -0,0 +1,147 @@
+#ifndef MATH_CORE_POLYNOMIAL_HPP
+#define MATH_CORE_POLYNOMIAL_HPP
+
+#include "concepts/arithmetic.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace math {
+
+namespace poly {
+
+// Number of coefficients from which evaluate() uses Estrin's scheme. Horner
+// is a chain of dependent multiply-adds, one per coefficient; Estrin pairs
+// the coefficients and recurses on x^2, so the dependency depth drops to
+// about 2 log2(N) at the cost of the extra squarings.
+inline constexpr std::size_t estrin_min_size = 8;
+
+// Leading coefficients evaluate() keeps in Horner form ahead of the Estrin
+// part: c0 + x (c1 + x E(x)). The final roundings then match Horner's,
+// which matters for the range-reduced kernels (exp, log, erf) whose
+// leading terms dominate; the Estrin part only carries the x^2-scaled tail.
+inline constexpr std::size_t horner_head = 2;
+
+namespace detail {
+
+template<std::size_t K, typename T, std::size_t N>
+constexpr T horner_from(const std::array<T, N>& c, T x) {
+    if constexpr (K + 1 == N) {
+        return c[K];
+    } else {
+        return horner_from<K + 1>(c, x) * x + c[K];
+    }
+}
+
+template<std::size_t J, typename T, std::size_t N>
+constexpr T estrin_pair(const std::array<T, N>& c, T x) {
+    if constexpr (2 * J + 1 < N) {
+        return c[2 * J + 1] * x + c[2 * J];
+    } else {
+        return c[2 * J];
+    }
+}
+
+template<typename T, std::size_t N, std::size_t... J>
+constexpr std::array<T, sizeof...(J)> estrin_pairs(const std::array<T, N>& c, T x, std::index_sequence<J...>) {
+    return {estrin_pair<J>(c, x)...};
+}
+
+template<std::size_t Offset, typename T, std::size_t N, std::size_t... J>
+constexpr std::array<T, sizeof...(J)> slice(const std::array<T, N>& c, std::index_sequence<J...>) {
+    return {c[Offset + J]...};
+}
+
+}
+
+// All evaluators take coefficients in ascending powers and are unrolled at
+// compile time, so a loop calling them stays a straight-line block the
+// vectorizer can widen.
+template<typename T, std::size_t N>
+constexpr T horner(const std::array<T, N>& c, T x) {
+    if constexpr (N == 0) {
+        return T{0};
+    } else {
+        return detail::horner_from<0>(c, x);
+    }
+}
+
+template<typename T, std::size_t N>
+constexpr T estrin(const std::array<T, N>& c, T x) {
+    if constexpr (N <= 2) {
+        return horner(c, x);
+    } else {
+        return estrin(detail::estrin_pairs(c, x, std::make_index_sequence<(N + 1) / 2>{}), x * x);
+    }
+}
+
+template<typename T, std::size_t N>
+constexpr T evaluate(const std::array<T, N>& c, T x) {
+    if constexpr (N < estrin_min_size) {
+        return horner(c, x);
+    } else {
+        T tail = estrin(detail::slice<horner_head>(c, std::make_index_sequence<N - horner_head>{}), x);
+        for (std::size_t k = horner_head; k-- > 0;) {
+            tail = tail * x + c[k];
+        }
+        return tail;
+    }
+}
+
+}
+
+// p(x) = c[0] + c[1] x + ... + c[N-1] x^(N-1), held as a constexpr table:
+//   static constexpr Polynomial<T, 3> p{{T{1}, T{2}, T{3}}};
+template<concepts::Arithmetic T, std::size_t N>
+struct Polynomial {
+    std::array<T, N> c;
+
+    static constexpr std::size_t size = N;
+
+    constexpr T operator()(T x) const {
+        return poly::evaluate(c, x);
+    }
+
+    // Batch form: out[i] = p(x[i]) over min(x.size(), out.size()) elements.
+    void operator()(std::span<const T> x, std::span<T> out) const {
+        std::size_t n = std::min(x.size(), out.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = (*this)(x[i]);
+        }
+    }
+
+    // Converts a table computed in another precision (typically long double
+    // tables generated at compile time).
+    template<typename U>
+    static constexpr Polynomial from(const U (&table)[N]) {
+        Polynomial p{};
+        for (std::size_t i = 0; i < N; ++i) {
+            p.c[i] = static_cast<T>(table[i]);
+        }
+        return p;
+    }
+};
+
+// r(x) = num(x) / den(x), one division per evaluation.
+template<concepts::Arithmetic T, std::size_t N, std::size_t M>
+struct Rational {
+    Polynomial<T, N> num;
+    Polynomial<T, M> den;
+
+    constexpr T operator()(T x) const {
+        return num(x) / den(x);
+    }
+
+    void operator()(std::span<const T> x, std::span<T> out) const {
+        std::size_t n = std::min(x.size(), out.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = (*this)(x[i]);
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef MATH_CORE_SIMD_HPP
+#define MATH_CORE_SIMD_HPP
+
+#include "concepts/arithmetic.hpp"
+#include "polynomial.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+namespace math::simd {
+
+// Width of the independent accumulator banks used by reduction kernels. Sized
+// for 256-bit registers; it is a fixed constant (not probed from the target)
+// so the association order, and therefore the rounding, is the same on every ISA.
+inline constexpr std::size_t register_bytes = 32;
+
+template<typename T>
+inline constexpr std::size_t lanes = register_bytes / sizeof(T) > 0 ? register_bytes / sizeof(T) : 1;
+
+namespace detail {
+
+template<typename T> struct float_bits {};
+template<> struct float_bits<float> { using uint = std::uint32_t; using sint = std::int32_t; };
+template<> struct float_bits<double> { using uint = std::uint64_t; using sint = std::int64_t; };
+
+template<typename T>
+concept Ieee = requires { typename float_bits<T>::uint; } && std::numeric_limits<T>::is_iec559;
+
+template<typename T>
+constexpr T pow2(int e) {
+    T result = T{1};
+    for (int i = 0; i < (e < 0 ? -e : e); ++i) {
+        result *= e < 0 ? T{0.5} : T{2};
+    }
+    return result;
+}
+
+// Taylor coefficients 1/k! of exp on |r| <= ln2/2.
+template<typename T, std::size_t N>
+constexpr Polynomial<T, N> exp_series() {
+    Polynomial<T, N> p{};
+    T f = T{1};
+    for (std::size_t k = 0; k < N; ++k) {
+        p.c[k] = T{1} / f;
+        f *= static_cast<T>(k + 1);
+    }
+    return p;
+}
+
+// 1/(2k+1): log(m) = 2 atanh(f) = 2 f sum f^(2k) / (2k+1), f = (m-1)/(m+1).
+template<typename T, std::size_t N>
+constexpr Polynomial<T, N> atanh_series() {
+    Polynomial<T, N> p{};
+    for (std::size_t k = 0; k < N; ++k) {
+        p.c[k] = T{1} / static_cast<T>(2 * k + 1);
+    }
+    return p;
+}
+
+template<typename T>
+struct Ln2 {
+    static constexpr T hi = T{0.693147180369123816490};
+    static constexpr T lo = T{1.90821492927058770002e-10};
+};
+
+template<>
+struct Ln2<float> {
+    static constexpr float hi = 0.693359375f;
+    static constexpr float lo = -2.12194440e-4f;
+};
+
+}
+
+// c ? a : b as a bit blend. A plain ?: on a float compare lets GCC sink the
+// unselected computation into a branch, which it then cannot if-convert
+// under the default -ftrapping-math.
+template<concepts::FloatingPoint T>
+inline T select(bool c, T a, T b) {
+    if constexpr (!detail::Ieee<T>) {
+        return c ? a : b;
+    } else {
+        using U = typename detail::float_bits<T>::uint;
+        U mask = U{0} - static_cast<U>(c);
+        return std::bit_cast<T>((std::bit_cast<U>(a) & mask) | (std::bit_cast<U>(b) & ~mask));
+    }
+}
+
+// Branch-free exp and log for float and double. Every case split is a
+// select, so a loop calling them vectorizes (-O3, or -O2 -ftree-vectorize);
+// accuracy is within two ulps over the full range, including subnormals,
+// infinities and NaN. Other types forward to <cmath>.
+template<concepts::FloatingPoint T>
+inline T exp(T x) {
+    if constexpr (!detail::Ieee<T>) {
+        return std::exp(x);
+    } else {
+        using S = typename detail::float_bits<T>::sint;
+        using U = typename detail::float_bits<T>::uint;
+        constexpr int mant = std::numeric_limits<T>::digits - 1;
+        constexpr S bias = std::numeric_limits<T>::max_exponent - 1;
+        constexpr T ln2 = std::numbers::ln2_v<T>;
+        constexpr T max_arg = static_cast<T>(std::numeric_limits<T>::max_exponent + 1) * ln2;
+        constexpr T min_arg = static_cast<T>(std::numeric_limits<T>::min_exponent - mant - 3) * ln2;
+        constexpr T shifter = T{1.5} * detail::pow2<T>(mant);
+        constexpr auto series = detail::exp_series<T, sizeof(T) == 4 ? 8 : 14>();
+
+        T t = x * std::numbers::log2e_v<T> + shifter;
+        T n = t - shifter;
+        U k = std::bit_cast<U>(t) - std::bit_cast<U>(shifter);
+        T r = (x - n * detail::Ln2<T>::hi) - n * detail::Ln2<T>::lo;
+        T p = series(r);
+
+        // 2^k as two factors so results near overflow or in the subnormal
+        // range are scaled without the exponent field wrapping. Integer work
+        // is unsigned so out-of-range lanes wrap harmlessly; the selects
+        // below replace them.
+        U k1 = static_cast<U>(static_cast<S>(k) >> 1);
+        U k2 = k - k1;
+        T s1 = std::bit_cast<T>((k1 + static_cast<U>(bias)) << mant);
+        T s2 = std::bit_cast<T>((k2 + static_cast<U>(bias)) << mant);
+        T result = p * s1 * s2;
+        result = select(x > max_arg, std::numeric_limits<T>::infinity(), result);
+        return select(x < min_arg, T{0}, result);
+    }
+}
+
+template<concepts::FloatingPoint T>
+inline T log(T x) {
+    if constexpr (!detail::Ieee<T>) {
+        return std::log(x);
+    } else {
+        using S = typename detail::float_bits<T>::sint;
+        using U = typename detail::float_bits<T>::uint;
+        constexpr int mant = std::numeric_limits<T>::digits - 1;
+        constexpr S bias = std::numeric_limits<T>::max_exponent - 1;
+        constexpr U mant_mask = (U{1} << mant) - 1;
+        constexpr U exp_mask = (U{1} << (sizeof(T) * 8 - 1 - mant)) - 1;
+        constexpr U one_bits = static_cast<U>(bias) << mant;
+        constexpr T scale = detail::pow2<T>(mant + 1);
+        constexpr T shifter = T{1.5} * detail::pow2<T>(mant);
+        constexpr auto series = detail::atanh_series<T, sizeof(T) == 4 ? 6 : 12>();
+
+        bool subnormal = x < std::numeric_limits<T>::min();
+        T xs = select(subnormal, x * scale, x);
+        U b = std::bit_cast<U>(xs);
+        S e = static_cast<S>((b >> mant) & exp_mask) - bias - static_cast<S>(subnormal) * (mant + 1);
+        T m = std::bit_cast<T>((b & mant_mask) | one_bits);
+
+        bool high = m > std::numbers::sqrt2_v<T>;
+        m = select(high, m * T{0.5}, m);
+        e += static_cast<S>(high);
+
+        T f = (m - T{1}) / (m + T{1});
+        T lm = T{2} * f * series(f * f);
+        // Integer to float through the mantissa of 1.5 * 2^mant; a direct
+        // int64 -> double conversion has no AVX2 vector form.
+        T ef = std::bit_cast<T>(std::bit_cast<U>(shifter) + static_cast<U>(e)) - shifter;
+        T result = ef * detail::Ln2<T>::hi + (lm + ef * detail::Ln2<T>::lo);
+
+        result = select(x > std::numeric_limits<T>::max(), x, result);
+        result = select(x <= T{0}, -std::numeric_limits<T>::infinity(), result);
+        return select(!(x >= T{0}), std::numeric_limits<T>::quiet_NaN(), result);
+    }
+}
+
+// out[i] = kernel(in[i]) over min(in.size(), out.size()) elements. The
+// kernel must be branch-free so the loop vectorizes.
+template<typename T, typename Kernel>
+void transform(std::span<const T> in, std::span<T> out, Kernel kernel) {
+    std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = kernel(in[i]);
+    }
+}
+
+// As above, then recomputes every element whose input is flagged by
+// needs_scalar with the scalar reference. The mask sweep is compare-only;
+// the slow path runs only for the edge-case lanes.
+template<typename T, typename Kernel, typename Mask, typename Scalar>
+void transform(std::span<const T> in, std::span<T> out, Kernel kernel, Mask needs_scalar, Scalar scalar) {
+    transform(in, out, kernel);
+    std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        if (needs_scalar(in[i])) {
+            out[i] = scalar(in[i]);
+        }
+    }
+}
+
+}
+
+#endif
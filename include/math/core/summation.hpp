@@ -0,0 +1,220 @@
+#ifndef MATH_CORE_SUMMATION_HPP
+#define MATH_CORE_SUMMATION_HPP
+
+#include "concepts/arithmetic.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <span>
+
+namespace math::summation {
+
+// Summation policies, passed as a trailing tag argument.
+//   naive     one running sum, error O(n eps)
+//   pairwise  lane-blocked leaves of 128 terms joined by a binary tree,
+//             error O(log n eps) at naive speed
+//   neumaier  compensated (Kahan-Babuska-Neumaier) per lane, error O(eps)
+//             independent of n; written branch-free with TwoSum
+//   dot2      neumaier plus exact products via fma (Ogita-Rump-Oishi);
+//             dot products come out as if computed in twice the precision
+struct naive_t {};
+struct pairwise_t {};
+struct neumaier_t {};
+struct dot2_t {};
+
+inline constexpr naive_t naive{};
+inline constexpr pairwise_t pairwise{};
+inline constexpr neumaier_t neumaier{};
+inline constexpr dot2_t dot2{};
+
+template<typename S>
+concept SummationPolicy = std::same_as<S, naive_t> || std::same_as<S, pairwise_t>
+                       || std::same_as<S, neumaier_t> || std::same_as<S, dot2_t>;
+
+inline constexpr std::size_t pairwise_block = 128;
+
+namespace detail {
+
+// s + x = sum + err exactly (Knuth's TwoSum, no branch on magnitudes).
+// A sum that is infinite or NaN has no rounding error to recover, and the
+// formula would give inf - inf = NaN, so err is 0 there; the select keeps
+// the loop branch-free.
+template<concepts::FloatingPoint T>
+constexpr void two_sum(T a, T b, T& sum, T& err) {
+    sum = a + b;
+    T z = sum - a;
+    T e = (a - (sum - z)) + (b - z);
+    err = std::isfinite(sum) ? e : T{0};
+}
+
+// Compensated fold of the lane sums followed by the lane compensations.
+// Sums go first so that large lane totals cancel before the (much smaller)
+// compensations are added.
+template<typename T, std::size_t W>
+T fold_lanes(const T (&sum)[W], const T (&comp)[W]) {
+    T total = T{0};
+    T err = T{0};
+    auto add = [&](T x) {
+        T t, e;
+        two_sum(total, x, t, e);
+        total = t;
+        err += e;
+    };
+    for (std::size_t lane = 0; lane < W; ++lane) {
+        add(sum[lane]);
+    }
+    for (std::size_t lane = 0; lane < W; ++lane) {
+        add(comp[lane]);
+    }
+    return total + err;
+}
+
+// Sum of f(i) over [begin, end) with simd::lanes<T> independent
+// accumulators folded pairwise at the end. The lane count is a compile-time
+// constant, so the association order is the same on every target.
+template<typename T, typename F>
+T lane_sum(std::size_t begin, std::size_t end, F& f) {
+    constexpr std::size_t W = simd::lanes<T>;
+    T acc[W] = {};
+    std::size_t i = begin;
+    for (; i + W <= end; i += W) {
+        for (std::size_t lane = 0; lane < W; ++lane) {
+            acc[lane] += f(i + lane);
+        }
+    }
+    for (std::size_t lane = 0; i < end; ++i, ++lane) {
+        acc[lane] += f(i);
+    }
+    for (std::size_t width = W / 2; width > 0; width /= 2) {
+        for (std::size_t lane = 0; lane < width; ++lane) {
+            acc[lane] += acc[lane + width];
+        }
+    }
+    return acc[0];
+}
+
+template<typename T, typename F>
+T naive_sum(std::size_t first, std::size_t last, F& f) {
+    T sum = T{0};
+    for (std::size_t i = first; i < last; ++i) {
+        sum += f(i);
+    }
+    return sum;
+}
+
+template<typename T, typename F>
+T pairwise_sum(std::size_t first, std::size_t last, F& f) {
+    std::size_t n = last - first;
+    if (n <= pairwise_block) {
+        return lane_sum<T>(first, last, f);
+    }
+    std::size_t half = (n / 2 + simd::lanes<T> - 1) / simd::lanes<T> * simd::lanes<T>;
+    return pairwise_sum<T>(first, first + half, f) + pairwise_sum<T>(first + half, last, f);
+}
+
+// W lanes of (sum, compensation) pairs. Each add is an error-free TwoSum,
+// so the loop has no data-dependent branch and vectorizes like lane_sum.
+template<typename T, typename F>
+T compensated_sum(std::size_t first, std::size_t last, F& f) {
+    constexpr std::size_t W = simd::lanes<T>;
+    T sum[W] = {};
+    T comp[W] = {};
+
+    auto add = [&](std::size_t lane, std::size_t i) {
+        T t, e;
+        two_sum(sum[lane], f(i), t, e);
+        sum[lane] = t;
+        comp[lane] += e;
+    };
+
+    std::size_t i = first;
+    for (; i + W <= last; i += W) {
+        for (std::size_t lane = 0; lane < W; ++lane) {
+            add(lane, i + lane);
+        }
+    }
+    for (std::size_t lane = 0; i < last; ++i, ++lane) {
+        add(lane, i);
+    }
+
+    return fold_lanes<T, W>(sum, comp);
+}
+
+// As compensated_sum over a(i) * b(i), with the rounding error of each
+// product recovered exactly by fma and folded into the compensation.
+template<typename T, typename A, typename B>
+T dot2_sum(std::size_t first, std::size_t last, const A& a, const B& b) {
+    constexpr std::size_t W = simd::lanes<T>;
+    T sum[W] = {};
+    T comp[W] = {};
+
+    auto add = [&](std::size_t lane, std::size_t i) {
+        T p = a(i) * b(i);
+        T p_err = std::isfinite(p) ? std::fma(a(i), b(i), -p) : T{0};
+        T t, e;
+        two_sum(sum[lane], p, t, e);
+        sum[lane] = t;
+        comp[lane] += e + p_err;
+    };
+
+    std::size_t i = first;
+    for (; i + W <= last; i += W) {
+        for (std::size_t lane = 0; lane < W; ++lane) {
+            add(lane, i + lane);
+        }
+    }
+    for (std::size_t lane = 0; i < last; ++i, ++lane) {
+        add(lane, i);
+    }
+
+    return fold_lanes<T, W>(sum, comp);
+}
+
+}
+
+// Sum of f(i) for i in [first, last) under policy S. For integral T every
+// policy reduces to the plain sum, which is already exact.
+template<typename T, SummationPolicy S = pairwise_t, typename F>
+T transform_sum(std::size_t first, std::size_t last, F&& f, S = {}) {
+    if (last <= first) {
+        return T{0};
+    }
+    if constexpr (!concepts::FloatingPoint<T> || std::same_as<S, naive_t>) {
+        return detail::naive_sum<T>(first, last, f);
+    } else if constexpr (std::same_as<S, pairwise_t>) {
+        return detail::pairwise_sum<T>(first, last, f);
+    } else {
+        return detail::compensated_sum<T>(first, last, f);
+    }
+}
+
+// Sum of a(i) * b(i) for i in [first, last). Only dot2 treats the products
+// specially; the other policies sum the rounded products.
+template<typename T, SummationPolicy S = pairwise_t, typename A, typename B>
+T transform_dot(std::size_t first, std::size_t last, A&& a, B&& b, S policy = {}) {
+    if (last <= first) {
+        return T{0};
+    }
+    if constexpr (concepts::FloatingPoint<T> && std::same_as<S, dot2_t>) {
+        return detail::dot2_sum<T>(first, last, a, b);
+    } else {
+        return transform_sum<T>(first, last, [&a, &b](std::size_t i) { return a(i) * b(i); }, policy);
+    }
+}
+
+template<concepts::Arithmetic T, SummationPolicy S = pairwise_t>
+T sum(std::span<const T> data, S policy = {}) {
+    return transform_sum<T>(0, data.size(), [data](std::size_t i) { return data[i]; }, policy);
+}
+
+template<concepts::Arithmetic T, SummationPolicy S = pairwise_t>
+T dot(std::span<const T> a, std::span<const T> b, S policy = {}) {
+    std::size_t n = std::min(a.size(), b.size());
+    return transform_dot<T>(0, n, [a](std::size_t i) { return a[i]; },
+                                  [b](std::size_t i) { return b[i]; }, policy);
+}
+
+}
+
+#endif
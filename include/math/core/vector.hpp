@@ -2,9 +2,11 @@
 #define MATH_CORE_VECTOR_HPP
 
 #include "concepts/arithmetic.hpp"
+#include "summation.hpp"
 #include <array>
 #include <cmath>
 #include <iostream>
+#include <span>
 
 namespace math {
 
@@ -32,6 +34,9 @@ public:
     constexpr T& operator()(std::size_t i) { return data_[i]; }
     constexpr const T& operator()(std::size_t i) const { return data_[i]; }
 
+    constexpr T* data() { return data_.data(); }
+    constexpr const T* data() const { return data_.data(); }
+
     constexpr auto begin() { return data_.begin(); }
     constexpr auto end() { return data_.end(); }
     constexpr auto begin() const { return data_.begin(); }
@@ -132,6 +137,12 @@ constexpr T dot(const Vector<T, N>& a, const Vector<T, N>& b) {
     return a.dot(b);
 }
 
+// Dot product under a summation policy, e.g. dot(a, b, summation::dot2).
+template<concepts::Arithmetic T, std::size_t N, summation::SummationPolicy S>
+T dot(const Vector<T, N>& a, const Vector<T, N>& b, S policy) {
+    return summation::dot(std::span<const T>(a.data(), N), std::span<const T>(b.data(), N), policy);
+}
+
 template<concepts::Arithmetic T, std::size_t N>
 T norm(const Vector<T, N>& v) {
     return v.norm();
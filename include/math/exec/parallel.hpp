@@ -0,0 +1,145 @@
+#ifndef MATH_EXEC_PARALLEL_HPP
+#define MATH_EXEC_PARALLEL_HPP
+
+#include "../core/summation.hpp"
+#include "policy.hpp"
+#include "reduce.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace math::exec {
+
+template<ExecutionPolicy P>
+ThreadPool& pool_of(const P& policy) {
+    if constexpr (ParallelPolicy<P>) {
+        return policy.pool ? *policy.pool : default_pool();
+    } else {
+        return default_pool();
+    }
+}
+
+namespace detail {
+
+// Chunk size for n items: the policy's explicit grain if set, otherwise
+// about four chunks per worker but never fewer than min_grain items.
+template<ExecutionPolicy P>
+std::size_t resolve_grain(const P& policy, std::size_t n, std::size_t min_grain) {
+    std::size_t grain = grain_of(policy);
+    if (grain == 0) {
+        std::size_t target = pool_of(policy).size() * 4;
+        grain = std::max(min_grain, (n + target - 1) / target);
+    }
+    return std::max<std::size_t>(grain, 1);
+}
+
+template<bool Simd, typename T, typename F>
+T chunk_sum(std::size_t begin, std::size_t end, F& f) {
+    if constexpr (Simd) {
+        return summation::transform_sum<T>(begin, end, f, summation::pairwise);
+    } else {
+        T sum = T{0};
+        for (std::size_t i = begin; i < end; ++i) {
+            sum += f(i);
+        }
+        return sum;
+    }
+}
+
+}
+
+// Runs body(begin, end) over consecutive chunks of [first, last). The
+// calling thread executes the first chunk itself and then helps the pool
+// until every chunk has finished.
+template<ExecutionPolicy P, typename Body>
+void parallel_for(const P& policy, std::size_t first, std::size_t last, std::size_t min_grain, Body&& body) {
+    if (last <= first) {
+        return;
+    }
+    if constexpr (!ParallelPolicy<P>) {
+        body(first, last);
+    } else {
+        std::size_t n = last - first;
+        std::size_t grain = detail::resolve_grain(policy, n, min_grain);
+        if (grain >= n) {
+            body(first, last);
+            return;
+        }
+
+        TaskGroup group(pool_of(policy));
+        for (std::size_t begin = first + grain; begin < last; begin += grain) {
+            std::size_t end = std::min(last, begin + grain);
+            group.run([&body, begin, end] { body(begin, end); });
+        }
+        body(first, first + grain);
+        group.wait();
+    }
+}
+
+// Maps each chunk to a partial result and folds the partials in chunk
+// order with reduce.
+template<ExecutionPolicy P, typename T, typename Map, typename Reduce>
+T parallel_reduce(const P& policy, std::size_t first, std::size_t last, std::size_t min_grain,
+                  T identity, Map&& map, Reduce&& reduce) {
+    if (last <= first) {
+        return identity;
+    }
+    if constexpr (!ParallelPolicy<P>) {
+        return reduce(identity, map(first, last));
+    } else {
+        std::size_t n = last - first;
+        std::size_t grain = detail::resolve_grain(policy, n, min_grain);
+        std::size_t chunks = (n + grain - 1) / grain;
+        if (chunks == 1) {
+            return reduce(identity, map(first, last));
+        }
+
+        std::vector<T> partials(chunks, identity);
+        parallel_for(policy.with_grain(1), 0, chunks, 1, [&](std::size_t c0, std::size_t c1) {
+            for (std::size_t c = c0; c < c1; ++c) {
+                std::size_t begin = first + c * grain;
+                partials[c] = map(begin, std::min(last, begin + grain));
+            }
+        });
+
+        T result = identity;
+        for (const auto& p : partials) {
+            result = reduce(result, p);
+        }
+        return result;
+    }
+}
+
+// Sum of f(i) for i in [0, n). par_simd sums each chunk pairwise over
+// lane-blocked leaves so the inner loop vectorizes. deterministic lane-sums
+// fixed blocks and folds the block sums with the fixed
+// pairwise tree of deterministic_sum, whatever the thread split.
+template<typename T, ExecutionPolicy P, typename F>
+T transform_sum(const P& policy, std::size_t n, F&& f) {
+    if constexpr (DeterministicPolicy<P>) {
+        std::size_t blocks = (n + deterministic_block - 1) / deterministic_block;
+        if (blocks <= 1) {
+            return lane_sum<T>(0, n, f);
+        }
+        std::vector<T> partials(blocks);
+        parallel_for(policy, 0, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+            for (std::size_t b = b0; b < b1; ++b) {
+                std::size_t begin = b * deterministic_block;
+                partials[b] = lane_sum<T>(begin, std::min(n, begin + deterministic_block), f);
+            }
+        });
+        return pairwise_combine(partials.data(), blocks);
+    }
+
+    constexpr bool simd = std::is_same_v<std::remove_cvref_t<P>, parallel_simd_policy>;
+    constexpr std::size_t min_grain = std::size_t{1} << 14;
+    return parallel_reduce(policy, 0, n, min_grain, T{0},
+        [&f](std::size_t begin, std::size_t end) { return detail::chunk_sum<simd, T>(begin, end, f); },
+        [](T a, T b) { return a + b; });
+}
+
+}
+
+#endif
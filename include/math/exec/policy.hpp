@@ -0,0 +1,82 @@
+#ifndef MATH_EXEC_POLICY_HPP
+#define MATH_EXEC_POLICY_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace math::exec {
+
+class ThreadPool;
+
+// Execution policies accepted as the first argument of the heavy kernels.
+// A grain of 0 lets the kernel pick its chunk size; a null pool means
+// default_pool().
+
+struct sequenced_policy {};
+
+struct parallel_policy {
+    std::size_t grain = 0;
+    ThreadPool* pool = nullptr;
+
+    constexpr parallel_policy with_grain(std::size_t g) const { return {g, pool}; }
+    constexpr parallel_policy on(ThreadPool& p) const { return {grain, &p}; }
+};
+
+// Parallel across chunks and lane-blocked (vectorizable) within each chunk.
+struct parallel_simd_policy {
+    std::size_t grain = 0;
+    ThreadPool* pool = nullptr;
+
+    constexpr parallel_simd_policy with_grain(std::size_t g) const { return {g, pool}; }
+    constexpr parallel_simd_policy on(ThreadPool& p) const { return {grain, &p}; }
+};
+
+// Parallel, but every reduction is split into fixed-size blocks and the
+// block results are combined by a fixed pairwise tree. Results are
+// bitwise identical for any thread count, grain or pool.
+struct deterministic_policy {
+    std::size_t grain = 0;
+    ThreadPool* pool = nullptr;
+
+    constexpr deterministic_policy with_grain(std::size_t g) const { return {g, pool}; }
+    constexpr deterministic_policy on(ThreadPool& p) const { return {grain, &p}; }
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_simd_policy par_simd{};
+inline constexpr deterministic_policy deterministic{};
+
+template<typename P>
+struct is_execution_policy : std::false_type {};
+
+template<> struct is_execution_policy<sequenced_policy> : std::true_type {};
+template<> struct is_execution_policy<parallel_policy> : std::true_type {};
+template<> struct is_execution_policy<parallel_simd_policy> : std::true_type {};
+template<> struct is_execution_policy<deterministic_policy> : std::true_type {};
+
+template<typename P>
+inline constexpr bool is_execution_policy_v = is_execution_policy<std::remove_cvref_t<P>>::value;
+
+template<typename P>
+concept ExecutionPolicy = is_execution_policy_v<P>;
+
+template<typename P>
+concept ParallelPolicy = ExecutionPolicy<P> && !std::same_as<std::remove_cvref_t<P>, sequenced_policy>;
+
+template<typename P>
+concept DeterministicPolicy = std::same_as<std::remove_cvref_t<P>, deterministic_policy>;
+
+template<ExecutionPolicy P>
+constexpr std::size_t grain_of(const P& policy) {
+    if constexpr (ParallelPolicy<P>) {
+        return policy.grain;
+    } else {
+        return 0;
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef MATH_EXEC_REDUCE_HPP
+#define MATH_EXEC_REDUCE_HPP
+
+#include "../core/summation.hpp"
+#include <cstddef>
+
+namespace math::exec {
+
+// Block length of the deterministic reduction. Partial sums are formed per
+// block, so this constant (not the thread count) fixes the rounding.
+inline constexpr std::size_t deterministic_block = 4096;
+
+// The lane-blocked kernel itself is sequential and lives with the other
+// summation kernels in core.
+using summation::detail::lane_sum;
+
+// Fixed-shape pairwise fold of values[0, n): split at the largest power of
+// two below n. The tree depends only on n.
+template<typename T>
+T pairwise_combine(const T* values, std::size_t n) {
+    if (n == 0) {
+        return T{0};
+    }
+    if (n == 1) {
+        return values[0];
+    }
+    std::size_t half = 1;
+    while (half * 2 < n) {
+        half *= 2;
+    }
+    return pairwise_combine(values, half) + pairwise_combine(values + half, n - half);
+}
+
+// Sequential reference of the deterministic reduction over [first, last):
+// the same blocks and tree that deterministic_policy uses across threads.
+template<typename T, typename F>
+T deterministic_sum(std::size_t first, std::size_t last, F& f) {
+    std::size_t n = last - first;
+    std::size_t blocks = (n + deterministic_block - 1) / deterministic_block;
+    if (blocks <= 1) {
+        return lane_sum<T>(first, last, f);
+    }
+    std::size_t half = 1;
+    while (half * 2 < blocks) {
+        half *= 2;
+    }
+    std::size_t split = first + half * deterministic_block;
+    return deterministic_sum<T>(first, split, f) + deterministic_sum<T>(split, last, f);
+}
+
+}
+
+#endif
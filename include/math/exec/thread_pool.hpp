@@ -0,0 +1,220 @@
+#ifndef MATH_EXEC_THREAD_POOL_HPP
+#define MATH_EXEC_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace math::exec {
+
+// Fixed set of worker threads, each owning a deque. A worker pops its own
+// newest task (LIFO, cache-warm) and, when empty, steals the oldest task
+// from another worker (FIFO). Threads are started once and reused; no
+// call into the library spawns a thread.
+class ThreadPool {
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<std::size_t> next_queue_{0};
+    bool stopping_ = false;
+
+    static constexpr std::size_t no_worker = static_cast<std::size_t>(-1);
+
+    static const ThreadPool*& current_pool() {
+        thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static std::size_t& current_index() {
+        thread_local std::size_t index = no_worker;
+        return index;
+    }
+
+    std::size_t own_queue() const {
+        return current_pool() == this ? current_index() : no_worker;
+    }
+
+    void worker_loop(std::size_t index) {
+        current_pool() = this;
+        current_index() = index;
+
+        while (true) {
+            if (run_pending_task()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_acquire) > 0; });
+            if (stopping_ && queued_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    bool take(std::size_t index, bool newest, std::function<void()>& task) {
+        Queue& q = *queues_[index];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty()) {
+            return false;
+        }
+        if (newest) {
+            task = std::move(q.tasks.back());
+            q.tasks.pop_back();
+        } else {
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+        }
+        queued_.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+public:
+    static std::size_t default_thread_count() {
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    explicit ThreadPool(std::size_t threads = default_thread_count()) {
+        threads = std::max<std::size_t>(1, threads);
+        queues_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        threads_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            threads_.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& t : threads_) {
+            t.join();
+        }
+    }
+
+    std::size_t size() const { return threads_.size(); }
+
+    void submit(std::function<void()> task) {
+        std::size_t index = own_queue();
+        if (index == no_worker) {
+            index = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        queued_.fetch_add(1, std::memory_order_acq_rel);
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+        }
+        wake_.notify_one();
+    }
+
+    // Runs one queued task on the calling thread, if any. Threads blocked on
+    // a TaskGroup call this so nested parallel calls cannot deadlock.
+    bool run_pending_task() {
+        if (queued_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        std::function<void()> task;
+        std::size_t own = own_queue();
+        std::size_t n = queues_.size();
+
+        bool found = own != no_worker && take(own, true, task);
+        std::size_t start = own != no_worker ? own + 1 : next_queue_.load(std::memory_order_relaxed);
+        for (std::size_t k = 0; !found && k < n; ++k) {
+            std::size_t victim = (start + k) % n;
+            if (victim != own) {
+                found = take(victim, false, task);
+            }
+        }
+
+        if (!found) {
+            return false;
+        }
+        task();
+        return true;
+    }
+};
+
+// Process-wide pool sized to the hardware, created on first use.
+inline ThreadPool& default_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+// Fork/join scope on a pool. wait() helps execute queued work instead of
+// blocking, and rethrows the first exception raised by any task.
+class TaskGroup {
+    ThreadPool& pool_;
+    std::atomic<std::size_t> pending_{0};
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+public:
+    explicit TaskGroup(ThreadPool& pool) : pool_(pool) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        while (pending_.load(std::memory_order_acquire) > 0) {
+            if (!pool_.run_pending_task()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    template<typename F>
+    void run(F f) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        pool_.submit([this, f = std::move(f)]() mutable {
+            try {
+                f();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+            }
+            pending_.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    void wait() {
+        while (pending_.load(std::memory_order_acquire) > 0) {
+            if (!pool_.run_pending_task()) {
+                std::this_thread::yield();
+            }
+        }
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef MATH_GEOMETRY_QUATERNION_HPP
+#define MATH_GEOMETRY_QUATERNION_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include "../core/matrix.hpp"
+#include "../core/vector.hpp"
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace math::geometry {
+
+template<concepts::FloatingPoint T>
+struct Quaternion {
+    T w;
+    T x;
+    T y;
+    T z;
+
+    using value_type = T;
+
+    constexpr Quaternion() : w(T{1}), x(T{0}), y(T{0}), z(T{0}) {}
+
+    constexpr Quaternion(T w_, T x_, T y_, T z_) : w(w_), x(x_), y(y_), z(z_) {}
+
+    constexpr Quaternion(T w_, const Vec3<T>& v) : w(w_), x(v[0]), y(v[1]), z(v[2]) {}
+
+    static constexpr Quaternion identity() {
+        return Quaternion{};
+    }
+
+    static Quaternion from_axis_angle(const Vec3<T>& axis, T angle) {
+        Vec3<T> n = normalize(axis);
+        T half = angle * T{0.5};
+        T s = std::sin(half);
+        return Quaternion(std::cos(half), n[0] * s, n[1] * s, n[2] * s);
+    }
+
+    // Shepperd's method: branch on the largest diagonal term for stability.
+    static Quaternion from_matrix(const Matrix<T, 3, 3>& m) {
+        T tr = m.trace();
+        if (tr > T{0}) {
+            T s = std::sqrt(tr + T{1}) * T{2};
+            return Quaternion(T{0.25} * s,
+                              (m(2, 1) - m(1, 2)) / s,
+                              (m(0, 2) - m(2, 0)) / s,
+                              (m(1, 0) - m(0, 1)) / s);
+        }
+        if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2)) {
+            T s = std::sqrt(T{1} + m(0, 0) - m(1, 1) - m(2, 2)) * T{2};
+            return Quaternion((m(2, 1) - m(1, 2)) / s,
+                              T{0.25} * s,
+                              (m(0, 1) + m(1, 0)) / s,
+                              (m(0, 2) + m(2, 0)) / s);
+        }
+        if (m(1, 1) > m(2, 2)) {
+            T s = std::sqrt(T{1} + m(1, 1) - m(0, 0) - m(2, 2)) * T{2};
+            return Quaternion((m(0, 2) - m(2, 0)) / s,
+                              (m(0, 1) + m(1, 0)) / s,
+                              T{0.25} * s,
+                              (m(1, 2) + m(2, 1)) / s);
+        }
+        T s = std::sqrt(T{1} + m(2, 2) - m(0, 0) - m(1, 1)) * T{2};
+        return Quaternion((m(1, 0) - m(0, 1)) / s,
+                          (m(0, 2) + m(2, 0)) / s,
+                          (m(1, 2) + m(2, 1)) / s,
+                          T{0.25} * s);
+    }
+
+    constexpr Vec3<T> vec() const {
+        return Vec3<T>(x, y, z);
+    }
+
+    constexpr Quaternion operator+(const Quaternion& o) const {
+        return Quaternion(w + o.w, x + o.x, y + o.y, z + o.z);
+    }
+
+    constexpr Quaternion operator-(const Quaternion& o) const {
+        return Quaternion(w - o.w, x - o.x, y - o.y, z - o.z);
+    }
+
+    constexpr Quaternion operator-() const {
+        return Quaternion(-w, -x, -y, -z);
+    }
+
+    constexpr Quaternion operator*(T s) const {
+        return Quaternion(w * s, x * s, y * s, z * s);
+    }
+
+    constexpr Quaternion operator*(const Quaternion& o) const {
+        return Quaternion(w * o.w - x * o.x - y * o.y - z * o.z,
+                          w * o.x + x * o.w + y * o.z - z * o.y,
+                          w * o.y - x * o.z + y * o.w + z * o.x,
+                          w * o.z + x * o.y - y * o.x + z * o.w);
+    }
+
+    constexpr Quaternion& operator*=(const Quaternion& o) {
+        *this = *this * o;
+        return *this;
+    }
+
+    constexpr bool operator==(const Quaternion& o) const {
+        return w == o.w && x == o.x && y == o.y && z == o.z;
+    }
+
+    constexpr T dot(const Quaternion& o) const {
+        return w * o.w + x * o.x + y * o.y + z * o.z;
+    }
+
+    T norm() const {
+        return std::sqrt(dot(*this));
+    }
+
+    Quaternion normalized() const {
+        return *this * (T{1} / norm());
+    }
+
+    constexpr Quaternion conjugate() const {
+        return Quaternion(w, -x, -y, -z);
+    }
+
+    constexpr Quaternion inverse() const {
+        return conjugate() * (T{1} / dot(*this));
+    }
+
+    // v' = v + 2w (u x v) + 2 u x (u x v) for a unit quaternion (w, u).
+    constexpr Vec3<T> rotate(const Vec3<T>& v) const {
+        Vec3<T> u = vec();
+        Vec3<T> t = cross(u, v) * T{2};
+        return v + t * w + cross(u, t);
+    }
+
+    constexpr Matrix<T, 3, 3> to_matrix3() const {
+        T xx = x * x, yy = y * y, zz = z * z;
+        T xy = x * y, xz = x * z, yz = y * z;
+        T wx = w * x, wy = w * y, wz = w * z;
+
+        Matrix<T, 3, 3> m;
+        m(0, 0) = T{1} - T{2} * (yy + zz);
+        m(0, 1) = T{2} * (xy - wz);
+        m(0, 2) = T{2} * (xz + wy);
+        m(1, 0) = T{2} * (xy + wz);
+        m(1, 1) = T{1} - T{2} * (xx + zz);
+        m(1, 2) = T{2} * (yz - wx);
+        m(2, 0) = T{2} * (xz - wy);
+        m(2, 1) = T{2} * (yz + wx);
+        m(2, 2) = T{1} - T{2} * (xx + yy);
+        return m;
+    }
+
+    constexpr Matrix<T, 4, 4> to_matrix4() const {
+        auto r = to_matrix3();
+        Matrix<T, 4, 4> m;
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                m(i, j) = r(i, j);
+            }
+        }
+        m(3, 3) = T{1};
+        return m;
+    }
+};
+
+template<concepts::FloatingPoint T>
+constexpr Quaternion<T> operator*(T s, const Quaternion<T>& q) {
+    return q * s;
+}
+
+template<concepts::FloatingPoint T>
+constexpr T dot(const Quaternion<T>& a, const Quaternion<T>& b) {
+    return a.dot(b);
+}
+
+template<concepts::FloatingPoint T>
+Quaternion<T> normalize(const Quaternion<T>& q) {
+    return q.normalized();
+}
+
+template<concepts::FloatingPoint T>
+constexpr Quaternion<T> conjugate(const Quaternion<T>& q) {
+    return q.conjugate();
+}
+
+template<concepts::FloatingPoint T>
+constexpr Quaternion<T> inverse(const Quaternion<T>& q) {
+    return q.inverse();
+}
+
+// Normalized linear interpolation along the shorter arc. Not constant
+// velocity, but cheap and branch-light; good enough for small steps.
+template<concepts::FloatingPoint T>
+Quaternion<T> nlerp(const Quaternion<T>& a, const Quaternion<T>& b, T t) {
+    T sign = dot(a, b) < T{0} ? T{-1} : T{1};
+    return normalize(a * (T{1} - t) + b * (sign * t));
+}
+
+template<concepts::FloatingPoint T>
+Quaternion<T> slerp(const Quaternion<T>& a, const Quaternion<T>& b, T t) {
+    T cos_theta = dot(a, b);
+    Quaternion<T> end = b;
+    if (cos_theta < T{0}) {
+        cos_theta = -cos_theta;
+        end = -b;
+    }
+
+    if (cos_theta > T{1} - std::numeric_limits<T>::epsilon() * T{100}) {
+        return nlerp(a, end, t);
+    }
+
+    T theta = std::acos(cos_theta);
+    T inv_sin = T{1} / std::sin(theta);
+    T wa = std::sin((T{1} - t) * theta) * inv_sin;
+    T wb = std::sin(t * theta) * inv_sin;
+    return a * wa + end * wb;
+}
+
+template<concepts::FloatingPoint T>
+std::ostream& operator<<(std::ostream& os, const Quaternion<T>& q) {
+    os << "(" << q.w << ", " << q.x << ", " << q.y << ", " << q.z << ")";
+    return os;
+}
+
+template<concepts::FloatingPoint T>
+using Quat = Quaternion<T>;
+
+}
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef MATH_GEOMETRY_TRANSFORM_HPP
+#define MATH_GEOMETRY_TRANSFORM_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include "../core/matrix.hpp"
+#include "../core/vector.hpp"
+#include "../linalg/operations.hpp"
+#include "quaternion.hpp"
+#include <algorithm>
+#include <span>
+
+namespace math::geometry {
+
+// General affine map x -> L x + t. Composition is a 3x3 product plus a
+// matrix-vector product (36 multiplies instead of 64 for a 4x4).
+template<concepts::FloatingPoint T>
+struct Affine3 {
+    Matrix<T, 3, 3> linear;
+    Vec3<T> translation;
+
+    constexpr Affine3() : linear(Matrix<T, 3, 3>::identity()), translation() {}
+
+    constexpr Affine3(const Matrix<T, 3, 3>& l, const Vec3<T>& t) : linear(l), translation(t) {}
+
+    static constexpr Affine3 identity() {
+        return Affine3{};
+    }
+
+    static constexpr Affine3 from_trs(const Vec3<T>& t, const Quaternion<T>& r, const Vec3<T>& s) {
+        auto l = r.to_matrix3();
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                l(i, j) *= s[j];
+            }
+        }
+        return Affine3(l, t);
+    }
+
+    static constexpr Affine3 from_matrix(const Matrix<T, 4, 4>& m) {
+        Affine3 a;
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                a.linear(i, j) = m(i, j);
+            }
+            a.translation[i] = m(i, 3);
+        }
+        return a;
+    }
+
+    constexpr Affine3 operator*(const Affine3& o) const {
+        return Affine3(linear * o.linear, linear * o.translation + translation);
+    }
+
+    constexpr Vec3<T> transform_point(const Vec3<T>& p) const {
+        return linear * p + translation;
+    }
+
+    constexpr Vec3<T> transform_vector(const Vec3<T>& v) const {
+        return linear * v;
+    }
+
+    constexpr Affine3 inverse() const {
+        auto inv = linalg::inverse(linear);
+        return Affine3(inv, (inv * translation) * T{-1});
+    }
+
+    // Valid only when the linear part is orthonormal (pure rotation).
+    constexpr Affine3 rigid_inverse() const {
+        auto rt = linear.transpose();
+        return Affine3(rt, (rt * translation) * T{-1});
+    }
+
+    constexpr Matrix<T, 4, 4> to_matrix4() const {
+        Matrix<T, 4, 4> m;
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                m(i, j) = linear(i, j);
+            }
+            m(i, 3) = translation[i];
+        }
+        m(3, 3) = T{1};
+        return m;
+    }
+};
+
+// Similarity transform x -> s R x + t with a unit quaternion rotation and a
+// uniform scale. This set is closed under composition and inversion, so
+// both have closed forms and never touch a matrix.
+template<concepts::FloatingPoint T>
+struct Transform {
+    Quaternion<T> rotation;
+    Vec3<T> translation;
+    T scale;
+
+    constexpr Transform() : rotation(), translation(), scale(T{1}) {}
+
+    constexpr Transform(const Vec3<T>& t, const Quaternion<T>& r, T s = T{1})
+        : rotation(r), translation(t), scale(s) {}
+
+    static constexpr Transform identity() {
+        return Transform{};
+    }
+
+    constexpr Transform operator*(const Transform& o) const {
+        return Transform(rotation.rotate(o.translation) * scale + translation,
+                         rotation * o.rotation,
+                         scale * o.scale);
+    }
+
+    constexpr Vec3<T> transform_point(const Vec3<T>& p) const {
+        return rotation.rotate(p) * scale + translation;
+    }
+
+    constexpr Vec3<T> transform_vector(const Vec3<T>& v) const {
+        return rotation.rotate(v) * scale;
+    }
+
+    constexpr Transform inverse() const {
+        T inv_scale = T{1} / scale;
+        auto inv_rotation = rotation.conjugate();
+        return Transform(inv_rotation.rotate(translation) * -inv_scale, inv_rotation, inv_scale);
+    }
+
+    constexpr Affine3<T> to_affine() const {
+        auto l = rotation.to_matrix3() * scale;
+        return Affine3<T>(l, translation);
+    }
+
+    constexpr Matrix<T, 4, 4> to_matrix4() const {
+        return to_affine().to_matrix4();
+    }
+};
+
+template<concepts::FloatingPoint T>
+Transform<T> interpolate(const Transform<T>& a, const Transform<T>& b, T t) {
+    return Transform<T>(a.translation + (b.translation - a.translation) * t,
+                        slerp(a.rotation, b.rotation, t),
+                        a.scale + (b.scale - a.scale) * t);
+}
+
+template<concepts::FloatingPoint T>
+void to_matrices(std::span<const Transform<T>> in, std::span<Matrix<T, 4, 4>> out) {
+    std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = in[i].to_matrix4();
+    }
+}
+
+template<concepts::FloatingPoint T>
+void to_matrices(std::span<const Affine3<T>> in, std::span<Matrix<T, 4, 4>> out) {
+    std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = in[i].to_matrix4();
+    }
+}
+
+// Hierarchy update: world[i] = world[parent[i]] * local[i]. Parents must
+// precede their children; a parent index >= i marks a root.
+template<concepts::FloatingPoint T>
+void compose_hierarchy(std::span<const Transform<T>> local,
+                       std::span<const std::size_t> parent,
+                       std::span<Transform<T>> world) {
+    for (std::size_t i = 0; i < local.size(); ++i) {
+        world[i] = parent[i] < i ? world[parent[i]] * local[i] : local[i];
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,452 @@
+#ifndef MATH_LINALG_BANDED_HPP
+#define MATH_LINALG_BANDED_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace math::linalg {
+
+// Runtime-sized n x n tridiagonal matrix. lower[i] = A(i+1, i),
+// diag[i] = A(i, i), upper[i] = A(i, i+1).
+template<concepts::FloatingPoint T>
+class TridiagonalMatrix {
+    std::vector<T> lower_;
+    std::vector<T> diag_;
+    std::vector<T> upper_;
+
+public:
+    using value_type = T;
+
+    explicit TridiagonalMatrix(std::size_t n)
+        : lower_(n > 0 ? n - 1 : 0), diag_(n), upper_(n > 0 ? n - 1 : 0) {}
+
+    TridiagonalMatrix(std::vector<T> lower, std::vector<T> diag, std::vector<T> upper)
+        : lower_(std::move(lower)), diag_(std::move(diag)), upper_(std::move(upper)) {}
+
+    std::size_t size() const { return diag_.size(); }
+    std::size_t rows() const { return diag_.size(); }
+    std::size_t cols() const { return diag_.size(); }
+
+    std::span<T> lower() { return lower_; }
+    std::span<T> diag() { return diag_; }
+    std::span<T> upper() { return upper_; }
+    std::span<const T> lower() const { return lower_; }
+    std::span<const T> diag() const { return diag_; }
+    std::span<const T> upper() const { return upper_; }
+
+    T operator()(std::size_t i, std::size_t j) const {
+        if (i == j) return diag_[i];
+        if (i == j + 1) return lower_[j];
+        if (j == i + 1) return upper_[i];
+        return T{0};
+    }
+
+    std::vector<T> operator*(std::span<const T> x) const {
+        std::size_t n = size();
+        std::vector<T> y(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            T sum = diag_[i] * x[i];
+            if (i > 0) sum += lower_[i - 1] * x[i - 1];
+            if (i + 1 < n) sum += upper_[i] * x[i + 1];
+            y[i] = sum;
+        }
+        return y;
+    }
+};
+
+// Thomas algorithm: O(n), no pivoting. Fails on a zero pivot, which cannot
+// happen for diagonally dominant or symmetric positive definite systems.
+template<concepts::FloatingPoint T>
+std::optional<std::vector<T>> thomas_solve(const TridiagonalMatrix<T>& A, std::span<const T> b) {
+    std::size_t n = A.size();
+    if (n == 0 || b.size() != n) {
+        return std::nullopt;
+    }
+
+    auto a = A.lower();
+    auto d = A.diag();
+    auto c = A.upper();
+
+    std::vector<T> c_prime(n);
+    std::vector<T> x(n);
+
+    T denom = d[0];
+    if (denom == T{0}) {
+        return std::nullopt;
+    }
+    c_prime[0] = n > 1 ? c[0] / denom : T{0};
+    x[0] = b[0] / denom;
+
+    for (std::size_t i = 1; i < n; ++i) {
+        denom = d[i] - a[i - 1] * c_prime[i - 1];
+        if (denom == T{0}) {
+            return std::nullopt;
+        }
+        c_prime[i] = i + 1 < n ? c[i] / denom : T{0};
+        x[i] = (b[i] - a[i - 1] * x[i - 1]) / denom;
+    }
+
+    for (std::size_t i = n - 1; i-- > 0; ) {
+        x[i] -= c_prime[i] * x[i + 1];
+    }
+
+    return x;
+}
+
+template<concepts::FloatingPoint T>
+std::optional<std::vector<T>> solve(const TridiagonalMatrix<T>& A, std::span<const T> b) {
+    return thomas_solve(A, b);
+}
+
+// Many independent tridiagonal systems of the same size n, stored
+// interleaved: coefficient i of system s lives at [i * count + s]. Every
+// inner loop then runs across systems with unit stride.
+template<concepts::FloatingPoint T>
+struct TridiagonalBatch {
+    std::size_t n;
+    std::size_t count;
+    std::vector<T> lower;
+    std::vector<T> diag;
+    std::vector<T> upper;
+
+    TridiagonalBatch(std::size_t n_, std::size_t count_)
+        : n(n_), count(count_), lower(n_ * count_), diag(n_ * count_), upper(n_ * count_) {}
+
+    // lower(i, s) multiplies x[i-1] in row i; lower(0, s) is ignored.
+    T& lower_at(std::size_t i, std::size_t s) { return lower[i * count + s]; }
+    T& diag_at(std::size_t i, std::size_t s) { return diag[i * count + s]; }
+    // upper(i, s) multiplies x[i+1] in row i; upper(n-1, s) is ignored.
+    T& upper_at(std::size_t i, std::size_t s) { return upper[i * count + s]; }
+};
+
+// Parallel cyclic reduction. Each of the ceil(log2 n) sweeps updates every
+// equation of every system independently from the previous sweep, so the
+// work is data-parallel over both equations and systems (no sequential
+// recurrence as in Thomas). rhs uses the same interleaved layout and is
+// overwritten with the solution. Returns false on a zero pivot.
+template<concepts::FloatingPoint T>
+bool cyclic_reduction_solve(const TridiagonalBatch<T>& batch, std::span<T> rhs) {
+    std::size_t n = batch.n;
+    std::size_t m = batch.count;
+    if (rhs.size() != n * m) {
+        return false;
+    }
+    if (n == 0 || m == 0) {
+        return true;
+    }
+
+    std::vector<T> a(batch.lower), b(batch.diag), c(batch.upper);
+    std::vector<T> d(rhs.begin(), rhs.end());
+    for (std::size_t s = 0; s < m; ++s) {
+        a[s] = T{0};
+        c[(n - 1) * m + s] = T{0};
+    }
+
+    std::vector<T> a2(n * m), b2(n * m), c2(n * m), d2(n * m);
+
+    for (std::size_t stride = 1; stride < n; stride *= 2) {
+        for (std::size_t i = 0; i < n; ++i) {
+            bool has_lo = i >= stride;
+            bool has_hi = i + stride < n;
+            std::size_t lo = has_lo ? (i - stride) * m : 0;
+            std::size_t hi = has_hi ? (i + stride) * m : 0;
+            std::size_t row = i * m;
+
+            for (std::size_t s = 0; s < m; ++s) {
+                T alpha = has_lo ? -a[row + s] / b[lo + s] : T{0};
+                T gamma = has_hi ? -c[row + s] / b[hi + s] : T{0};
+
+                a2[row + s] = has_lo ? alpha * a[lo + s] : T{0};
+                c2[row + s] = has_hi ? gamma * c[hi + s] : T{0};
+                b2[row + s] = b[row + s]
+                            + (has_lo ? alpha * c[lo + s] : T{0})
+                            + (has_hi ? gamma * a[hi + s] : T{0});
+                d2[row + s] = d[row + s]
+                            + (has_lo ? alpha * d[lo + s] : T{0})
+                            + (has_hi ? gamma * d[hi + s] : T{0});
+            }
+        }
+        std::swap(a, a2);
+        std::swap(b, b2);
+        std::swap(c, c2);
+        std::swap(d, d2);
+    }
+
+    for (std::size_t k = 0; k < n * m; ++k) {
+        if (b[k] == T{0} || !std::isfinite(b[k])) {
+            return false;
+        }
+        rhs[k] = d[k] / b[k];
+    }
+    return true;
+}
+
+template<concepts::FloatingPoint T>
+std::optional<std::vector<T>> cyclic_reduction_solve(const TridiagonalMatrix<T>& A, std::span<const T> b) {
+    std::size_t n = A.size();
+    if (b.size() != n) {
+        return std::nullopt;
+    }
+
+    TridiagonalBatch<T> batch(n, 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        batch.diag[i] = A.diag()[i];
+        if (i > 0) batch.lower[i] = A.lower()[i - 1];
+        if (i + 1 < n) batch.upper[i] = A.upper()[i];
+    }
+
+    std::vector<T> x(b.begin(), b.end());
+    if (!cyclic_reduction_solve(batch, std::span<T>(x))) {
+        return std::nullopt;
+    }
+    return x;
+}
+
+// Runtime-sized n x n band matrix with KL sub- and KU super-diagonals.
+// Row i stores columns i-KL .. i+KU contiguously.
+template<concepts::FloatingPoint T, std::size_t KL, std::size_t KU>
+class BandedMatrix {
+    std::size_t n_;
+    std::vector<T> data_;
+
+public:
+    using value_type = T;
+    static constexpr std::size_t lower_bandwidth = KL;
+    static constexpr std::size_t upper_bandwidth = KU;
+    static constexpr std::size_t band_width = KL + KU + 1;
+
+    explicit BandedMatrix(std::size_t n) : n_(n), data_(n * band_width) {}
+
+    std::size_t size() const { return n_; }
+    std::size_t rows() const { return n_; }
+    std::size_t cols() const { return n_; }
+
+    bool in_band(std::size_t i, std::size_t j) const {
+        return j + KL >= i && j <= i + KU;
+    }
+
+    // Only valid for (i, j) inside the band.
+    T& operator()(std::size_t i, std::size_t j) {
+        return data_[i * band_width + (j + KL - i)];
+    }
+
+    T operator()(std::size_t i, std::size_t j) const {
+        return in_band(i, j) ? data_[i * band_width + (j + KL - i)] : T{0};
+    }
+
+    std::vector<T> operator*(std::span<const T> x) const {
+        std::vector<T> y(n_);
+        for (std::size_t i = 0; i < n_; ++i) {
+            std::size_t j0 = i > KL ? i - KL : 0;
+            std::size_t j1 = std::min(n_ - 1, i + KU);
+            T sum = T{0};
+            for (std::size_t j = j0; j <= j1; ++j) {
+                sum += (*this)(i, j) * x[j];
+            }
+            y[i] = sum;
+        }
+        return y;
+    }
+};
+
+// Banded LU with partial pivoting. Row exchanges widen U to KL + KU
+// super-diagonals, so the working rows span columns i-KL .. i+KL+KU.
+// Cost O(n * KL * (KL + KU)).
+template<concepts::FloatingPoint T, std::size_t KL, std::size_t KU>
+struct BandedLU {
+    static constexpr std::size_t width = 2 * KL + KU + 1;
+
+    std::size_t n;
+    std::vector<T> U;
+    std::vector<T> L;
+    std::vector<std::size_t> pivots;
+    bool singular;
+
+    T& u(std::size_t i, std::size_t j) { return U[i * width + (j + KL - i)]; }
+    T u(std::size_t i, std::size_t j) const { return U[i * width + (j + KL - i)]; }
+};
+
+template<concepts::FloatingPoint T, std::size_t KL, std::size_t KU>
+BandedLU<T, KL, KU> banded_lu_decompose(const BandedMatrix<T, KL, KU>& A) {
+    std::size_t n = A.size();
+    BandedLU<T, KL, KU> result;
+    result.n = n;
+    result.U.assign(n * result.width, T{0});
+    result.L.assign(n * (KL > 0 ? KL : 1), T{0});
+    result.pivots.resize(n);
+    result.singular = false;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t j0 = i > KL ? i - KL : 0;
+        std::size_t j1 = std::min(n - 1, i + KU);
+        for (std::size_t j = j0; j <= j1; ++j) {
+            result.u(i, j) = A(i, j);
+        }
+    }
+
+    constexpr T epsilon = std::numeric_limits<T>::epsilon() * T{100};
+
+    for (std::size_t k = 0; k < n; ++k) {
+        std::size_t last_row = std::min(n - 1, k + KL);
+        std::size_t last_col = std::min(n - 1, k + KL + KU);
+
+        std::size_t pivot_row = k;
+        T max_val = std::abs(result.u(k, k));
+        for (std::size_t i = k + 1; i <= last_row; ++i) {
+            T val = std::abs(result.u(i, k));
+            if (val > max_val) {
+                max_val = val;
+                pivot_row = i;
+            }
+        }
+
+        result.pivots[k] = pivot_row;
+        if (max_val < epsilon) {
+            result.singular = true;
+            return result;
+        }
+
+        if (pivot_row != k) {
+            for (std::size_t j = k; j <= last_col; ++j) {
+                std::swap(result.u(k, j), result.u(pivot_row, j));
+            }
+        }
+
+        T inv_pivot = T{1} / result.u(k, k);
+        for (std::size_t i = k + 1; i <= last_row; ++i) {
+            T factor = result.u(i, k) * inv_pivot;
+            result.L[k * KL + (i - k - 1)] = factor;
+            result.u(i, k) = T{0};
+            for (std::size_t j = k + 1; j <= last_col; ++j) {
+                result.u(i, j) -= factor * result.u(k, j);
+            }
+        }
+    }
+
+    return result;
+}
+
+template<concepts::FloatingPoint T, std::size_t KL, std::size_t KU>
+std::optional<std::vector<T>> solve(const BandedLU<T, KL, KU>& lu, std::span<const T> b) {
+    std::size_t n = lu.n;
+    if (lu.singular || b.size() != n) {
+        return std::nullopt;
+    }
+
+    std::vector<T> x(b.begin(), b.end());
+
+    for (std::size_t k = 0; k < n; ++k) {
+        std::swap(x[k], x[lu.pivots[k]]);
+        std::size_t last_row = std::min(n - 1, k + KL);
+        for (std::size_t i = k + 1; i <= last_row; ++i) {
+            x[i] -= lu.L[k * KL + (i - k - 1)] * x[k];
+        }
+    }
+
+    for (std::size_t i = n; i-- > 0; ) {
+        std::size_t last_col = std::min(n - 1, i + KL + KU);
+        T sum = x[i];
+        for (std::size_t j = i + 1; j <= last_col; ++j) {
+            sum -= lu.u(i, j) * x[j];
+        }
+        x[i] = sum / lu.u(i, i);
+    }
+
+    return x;
+}
+
+template<concepts::FloatingPoint T, std::size_t KL, std::size_t KU>
+std::optional<std::vector<T>> solve(const BandedMatrix<T, KL, KU>& A, std::span<const T> b) {
+    return solve(banded_lu_decompose(A), b);
+}
+
+// Lower band factor L of a symmetric positive definite band matrix with
+// half-bandwidth K. Row i stores columns i-K .. i. Cost O(n * K^2).
+template<concepts::FloatingPoint T, std::size_t K>
+struct BandedCholesky {
+    std::size_t n;
+    std::vector<T> L;
+    bool positive_definite;
+
+    T& l(std::size_t i, std::size_t j) { return L[i * (K + 1) + (j + K - i)]; }
+    T l(std::size_t i, std::size_t j) const { return L[i * (K + 1) + (j + K - i)]; }
+};
+
+template<concepts::FloatingPoint T, std::size_t K>
+BandedCholesky<T, K> banded_cholesky_decompose(const BandedMatrix<T, K, K>& A) {
+    std::size_t n = A.size();
+    BandedCholesky<T, K> result;
+    result.n = n;
+    result.L.assign(n * (K + 1), T{0});
+    result.positive_definite = true;
+
+    constexpr T epsilon = std::numeric_limits<T>::epsilon() * T{100};
+
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t j0 = i > K ? i - K : 0;
+        for (std::size_t j = j0; j <= i; ++j) {
+            T sum = A(i, j);
+            std::size_t k0 = std::max(j0, j > K ? j - K : 0);
+            for (std::size_t k = k0; k < j; ++k) {
+                sum -= result.l(i, k) * result.l(j, k);
+            }
+
+            if (j == i) {
+                if (sum <= epsilon) {
+                    result.positive_definite = false;
+                    return result;
+                }
+                result.l(i, i) = std::sqrt(sum);
+            } else {
+                result.l(i, j) = sum / result.l(j, j);
+            }
+        }
+    }
+
+    return result;
+}
+
+template<concepts::FloatingPoint T, std::size_t K>
+std::optional<std::vector<T>> solve(const BandedCholesky<T, K>& chol, std::span<const T> b) {
+    std::size_t n = chol.n;
+    if (!chol.positive_definite || b.size() != n) {
+        return std::nullopt;
+    }
+
+    std::vector<T> x(b.begin(), b.end());
+
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t j0 = i > K ? i - K : 0;
+        T sum = x[i];
+        for (std::size_t j = j0; j < i; ++j) {
+            sum -= chol.l(i, j) * x[j];
+        }
+        x[i] = sum / chol.l(i, i);
+    }
+
+    for (std::size_t i = n; i-- > 0; ) {
+        std::size_t last = std::min(n - 1, i + K);
+        T sum = x[i];
+        for (std::size_t j = i + 1; j <= last; ++j) {
+            sum -= chol.l(j, i) * x[j];
+        }
+        x[i] = sum / chol.l(i, i);
+    }
+
+    return x;
+}
+
+template<concepts::FloatingPoint T, std::size_t K>
+std::optional<std::vector<T>> solve_cholesky(const BandedMatrix<T, K, K>& A, std::span<const T> b) {
+    return solve(banded_cholesky_decompose(A), b);
+}
+
+}
+
+#endif
@@ -3,6 +3,8 @@
 
 #include "../core/matrix.hpp"
 #include "../core/vector.hpp"
+#include "../exec/parallel.hpp"
+#include "../exec/policy.hpp"
 #include <cmath>
 #include <utility>
 #include <optional>
@@ -17,8 +19,11 @@ struct LUDecomposition {
     bool singular;
 };
 
-template<concepts::Arithmetic T, std::size_t N>
-LUDecomposition<T, N> lu_decompose(const Matrix<T, N, N>& A) {
+// The row updates below the pivot are independent, so a parallel policy
+// splits them across the pool; each row sees exactly the same operations
+// as in the sequential version.
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T, std::size_t N>
+LUDecomposition<T, N> lu_decompose(const Policy& policy, const Matrix<T, N, N>& A) {
     LUDecomposition<T, N> result;
     result.L = Matrix<T, N, N>::identity();
     result.U = A;
@@ -57,19 +62,27 @@ LUDecomposition<T, N> lu_decompose(const Matrix<T, N, N>& A) {
             std::swap(result.P[k], result.P[pivot_row]);
         }
         
-        for (std::size_t i = k + 1; i < N; ++i) {
-            T factor = result.U(i, k) / result.U(k, k);
-            result.L(i, k) = factor;
-            
-            for (std::size_t j = k; j < N; ++j) {
-                result.U(i, j) -= factor * result.U(k, j);
+        std::size_t min_rows = (N - k) >= 4096 ? 1 : 4096 / (N - k);
+        exec::parallel_for(policy, k + 1, N, min_rows, [&](std::size_t r0, std::size_t r1) {
+            for (std::size_t i = r0; i < r1; ++i) {
+                T factor = result.U(i, k) / result.U(k, k);
+                result.L(i, k) = factor;
+                
+                for (std::size_t j = k; j < N; ++j) {
+                    result.U(i, j) -= factor * result.U(k, j);
+                }
             }
-        }
+        });
     }
     
     return result;
 }
 
+template<concepts::Arithmetic T, std::size_t N>
+LUDecomposition<T, N> lu_decompose(const Matrix<T, N, N>& A) {
+    return lu_decompose(exec::seq, A);
+}
+
 template<concepts::Arithmetic T, std::size_t N>
 struct QRDecomposition {
     Matrix<T, N, N> Q;
@@ -4,7 +4,11 @@
 #include "../core/matrix.hpp"
 #include "../core/vector.hpp"
 #include "decomposition.hpp"
+#include "krylov.hpp"
 #include "norm.hpp"
+#include "operations.hpp"
+#include "operator.hpp"
+#include "solve.hpp"
 #include <cmath>
 #include <limits>
 
@@ -17,12 +21,16 @@ struct EigenResult {
     bool converged;
 };
 
-template<concepts::Arithmetic T, std::size_t N>
-std::pair<T, Vector<T, N>> power_iteration(const Matrix<T, N, N>& A, 
-                                            std::size_t max_iter = 1000,
-                                            T tolerance = T{1e-10}) {
-    Vector<T, N> v;
-    for (std::size_t i = 0; i < N; ++i) {
+template<concepts::LinearOperator Op>
+std::pair<typename Op::value_type, typename Op::vector_type> power_iteration(
+        const Op& op,
+        std::size_t max_iter = 1000,
+        typename Op::value_type tolerance = typename Op::value_type{1e-10}) {
+    using T = typename Op::value_type;
+    using V = typename Op::vector_type;
+
+    V v;
+    for (std::size_t i = 0; i < v.size(); ++i) {
         v[i] = T{1};
     }
     v = normalize(v);
@@ -30,7 +38,7 @@ std::pair<T, Vector<T, N>> power_iteration(const Matrix<T, N, N>& A,
     T eigenvalue = T{0};
     
     for (std::size_t iter = 0; iter < max_iter; ++iter) {
-        auto v_new = A * v;
+        auto v_new = op.apply(v);
         T eigenvalue_new = dot(v, v_new);
         
         v_new = normalize(v_new);
@@ -47,7 +55,15 @@ std::pair<T, Vector<T, N>> power_iteration(const Matrix<T, N, N>& A,
 }
 
 template<concepts::Arithmetic T, std::size_t N>
-EigenResult<T, N> qr_algorithm(const Matrix<T, N, N>& A,
+std::pair<T, Vector<T, N>> power_iteration(const Matrix<T, N, N>& A, 
+                                            std::size_t max_iter = 1000,
+                                            T tolerance = T{1e-10}) {
+    return power_iteration(make_operator(A), max_iter, tolerance);
+}
+
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T, std::size_t N>
+EigenResult<T, N> qr_algorithm(const Policy& policy,
+                                 const Matrix<T, N, N>& A,
                                  std::size_t max_iter = 1000,
                                  T tolerance = T{1e-10}) {
     EigenResult<T, N> result;
@@ -58,8 +74,8 @@ EigenResult<T, N> qr_algorithm(const Matrix<T, N, N>& A,
     
     for (std::size_t iter = 0; iter < max_iter; ++iter) {
         auto qr = qr_decompose(Ak);
-        Ak = qr.R * qr.Q;
-        Q_total = Q_total * qr.Q;
+        Ak = multiply(policy, qr.R, qr.Q);
+        Q_total = multiply(policy, Q_total, qr.Q);
         
         T off_diag_norm = T{0};
         for (std::size_t i = 0; i < N; ++i) {
@@ -87,11 +103,26 @@ EigenResult<T, N> qr_algorithm(const Matrix<T, N, N>& A,
 }
 
 template<concepts::Arithmetic T, std::size_t N>
-T rayleigh_quotient(const Matrix<T, N, N>& A, const Vector<T, N>& x) {
-    auto Ax = A * x;
+EigenResult<T, N> qr_algorithm(const Matrix<T, N, N>& A,
+                                 std::size_t max_iter = 1000,
+                                 T tolerance = T{1e-10}) {
+    return qr_algorithm(exec::seq, A, max_iter, tolerance);
+}
+
+template<concepts::LinearOperator Op>
+typename Op::value_type rayleigh_quotient(const Op& op, const typename Op::vector_type& x) {
+    auto Ax = op.apply(x);
     return dot(x, Ax) / dot(x, x);
 }
 
+template<concepts::Arithmetic T, std::size_t N>
+T rayleigh_quotient(const Matrix<T, N, N>& A, const Vector<T, N>& x) {
+    return rayleigh_quotient(make_operator(A), x);
+}
+
+// Each step solves (A - sigma I) w = v and normalizes w. The sign of w is
+// chosen to agree with v, since a shift above the target eigenvalue would
+// otherwise flip it every step and the iteration would never settle.
 template<concepts::Arithmetic T, std::size_t N>
 std::pair<T, Vector<T, N>> inverse_iteration(const Matrix<T, N, N>& A,
                                                T sigma,
@@ -115,6 +146,9 @@ std::pair<T, Vector<T, N>> inverse_iteration(const Matrix<T, N, N>& A,
         }
         
         auto v_new = normalize(*v_new_opt);
+        if (dot(v_new, v) < T{0}) {
+            v_new = v_new * T{-1};
+        }
         
         if (l2_norm(v_new - v) < tolerance) {
             T eigenvalue = rayleigh_quotient(A, v_new);
@@ -128,6 +162,59 @@ std::pair<T, Vector<T, N>> inverse_iteration(const Matrix<T, N, N>& A,
     return {eigenvalue, v};
 }
 
+// Matrix-free variant. A symmetric operator (one reporting symmetric()) is
+// solved by MINRES on A - sigma I, which stays accurate as sigma approaches
+// an eigenvalue; anything else falls back to CG on the normal equations,
+// whose squared condition number makes the shifted solves inexact close to
+// an eigenvalue. Either way the iteration stops on the eigen-residual
+// ||A v - lambda v||, not on the inner solve, so an inexact solve costs
+// extra steps rather than a wrong answer.
+template<concepts::LinearOperator Op>
+std::pair<typename Op::value_type, typename Op::vector_type> inverse_iteration(
+        const Op& op,
+        typename Op::value_type sigma,
+        std::size_t max_iter = 1000,
+        typename Op::value_type tolerance = typename Op::value_type{1e-10}) {
+    using T = typename Op::value_type;
+    using V = typename Op::vector_type;
+
+    auto op_shifted = shifted(op, sigma);
+    bool use_minres = false;
+    if constexpr (concepts::SymmetryAwareOperator<Op>) {
+        use_minres = op.symmetric();
+    }
+
+    V v;
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = T{1};
+    }
+    v = normalize(v);
+
+    std::size_t inner_iter = 10 * v.size() + 100;
+    for (std::size_t iter = 0; iter < max_iter; ++iter) {
+        auto inner = use_minres ? minres(op_shifted, v, inner_iter, tolerance)
+                                : cgnr(op_shifted, v, inner_iter, tolerance);
+        if (l2_norm(inner.x) == T{0}) {
+            break;
+        }
+
+        auto v_new = normalize(inner.x);
+        if (dot(v_new, v) < T{0}) {
+            v_new = v_new * T{-1};
+        }
+
+        auto Av = op.apply(v_new);
+        T lambda = dot(v_new, Av);
+        if (l2_norm(Av - v_new * lambda) <= tolerance * std::max(std::abs(lambda), T{1})) {
+            return {lambda, v_new};
+        }
+
+        v = v_new;
+    }
+
+    return {rayleigh_quotient(op, v), v};
+}
+
 }
 
 #endif
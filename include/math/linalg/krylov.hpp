@@ -0,0 +1,162 @@
+#ifndef MATH_LINALG_KRYLOV_HPP
+#define MATH_LINALG_KRYLOV_HPP
+
+#include "../core/concepts/linalg.hpp"
+#include "../core/vector.hpp"
+#include "operator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace math::linalg {
+
+template<typename V>
+struct IterativeResult {
+    V x;
+    std::size_t iterations;
+    typename V::value_type residual;
+    bool converged;
+};
+
+// Conjugate gradient for symmetric positive definite operators.
+template<concepts::LinearOperator Op>
+IterativeResult<typename Op::vector_type> conjugate_gradient(
+        const Op& op,
+        const typename Op::vector_type& b,
+        std::size_t max_iter = 1000,
+        typename Op::value_type tolerance = typename Op::value_type{1e-10}) {
+    using T = typename Op::value_type;
+    using V = typename Op::vector_type;
+
+    IterativeResult<V> result{V{}, 0, T{0}, false};
+
+    V r = b;
+    V p = r;
+    T rr = dot(r, r);
+    T threshold = tolerance * tolerance * std::max(dot(b, b), std::numeric_limits<T>::min());
+
+    if (rr <= threshold) {
+        result.converged = true;
+        result.residual = std::sqrt(rr);
+        return result;
+    }
+
+    for (std::size_t iter = 0; iter < max_iter; ++iter) {
+        V Ap = op.apply(p);
+        T pAp = dot(p, Ap);
+        if (pAp <= T{0}) {
+            break;
+        }
+
+        T alpha = rr / pAp;
+        result.x += p * alpha;
+        r -= Ap * alpha;
+
+        T rr_new = dot(r, r);
+        result.iterations = iter + 1;
+
+        if (rr_new <= threshold) {
+            rr = rr_new;
+            result.converged = true;
+            break;
+        }
+
+        p = r + p * (rr_new / rr);
+        rr = rr_new;
+    }
+
+    result.residual = std::sqrt(rr);
+    return result;
+}
+
+// CG on the normal equations A^T A x = A^T b; works for any nonsingular A.
+template<concepts::LinearOperator Op>
+IterativeResult<typename Op::vector_type> cgnr(
+        const Op& op,
+        const typename Op::vector_type& b,
+        std::size_t max_iter = 1000,
+        typename Op::value_type tolerance = typename Op::value_type{1e-10}) {
+    return conjugate_gradient(normal(op), op.apply_transpose(b), max_iter, tolerance);
+}
+
+// MINRES (Paige and Saunders, 1975) for symmetric operators, definite or
+// not: Lanczos vectors with a running QR of the tridiagonal, so the
+// residual norm ||b - A x|| is known at every step without forming it.
+// Unlike CGNR it works on A itself, so the condition number is not
+// squared; a nearly singular A still converges within about n steps.
+template<concepts::LinearOperator Op>
+IterativeResult<typename Op::vector_type> minres(
+        const Op& op,
+        const typename Op::vector_type& b,
+        std::size_t max_iter = 1000,
+        typename Op::value_type tolerance = typename Op::value_type{1e-10}) {
+    using T = typename Op::value_type;
+    using V = typename Op::vector_type;
+
+    IterativeResult<V> result{V{}, 0, T{0}, false};
+
+    T beta1 = std::sqrt(dot(b, b));
+    if (beta1 == T{0}) {
+        result.converged = true;
+        return result;
+    }
+
+    V r1 = b;
+    V r2 = b;
+    V y = b;
+    V w{};
+    V w1{};
+    V w2{};
+    T beta = beta1;
+    T old_beta = T{0};
+    T dbar = T{0};
+    T epsilon = T{0};
+    T phibar = beta1;
+    T cs = T{-1};
+    T sn = T{0};
+
+    for (std::size_t iter = 0; iter < max_iter; ++iter) {
+        V v = y * (T{1} / beta);
+        y = op.apply(v);
+        if (iter > 0) {
+            y -= r1 * (beta / old_beta);
+        }
+        T alpha = dot(v, y);
+        y -= r2 * (alpha / beta);
+        r1 = r2;
+        r2 = y;
+        old_beta = beta;
+        beta = std::sqrt(dot(y, y));
+
+        // Apply the previous rotation to the new column of the tridiagonal,
+        // then build the rotation that annihilates its subdiagonal.
+        T old_epsilon = epsilon;
+        T delta = cs * dbar + sn * alpha;
+        T gbar = sn * dbar - cs * alpha;
+        epsilon = sn * beta;
+        dbar = -cs * beta;
+        T gamma = std::max(std::hypot(gbar, beta), std::numeric_limits<T>::epsilon());
+        cs = gbar / gamma;
+        sn = beta / gamma;
+        T phi = cs * phibar;
+        phibar = sn * phibar;
+
+        w1 = w2;
+        w2 = w;
+        w = (v - w1 * old_epsilon - w2 * delta) * (T{1} / gamma);
+        result.x += w * phi;
+        result.iterations = iter + 1;
+
+        if (phibar <= tolerance * beta1 || beta == T{0}) {
+            result.converged = true;
+            break;
+        }
+    }
+
+    result.residual = phibar;
+    return result;
+}
+
+}
+
+#endif
@@ -3,24 +3,174 @@
 
 #include "../core/vector.hpp"
 #include "../core/matrix.hpp"
+#include "../core/simd.hpp"
+#include "../core/summation.hpp"
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <span>
 
 namespace math::linalg {
 
-template<concepts::Arithmetic T, std::size_t N>
-T l1_norm(const Vector<T, N>& v) {
-    T sum = T{0};
-    for (std::size_t i = 0; i < N; ++i) {
-        sum += std::abs(v[i]);
+template<concepts::FloatingPoint T>
+struct NormSummary {
+    T l1;
+    T l2;
+    T linf;
+    std::size_t non_finite;
+};
+
+namespace detail {
+
+// Blue's scaling constants (as in the reference BLAS nrm2): squares of values
+// in [tsml, tbig] can neither overflow nor underflow; values outside are
+// accumulated pre-scaled by ssml / sbig.
+template<concepts::FloatingPoint T>
+struct BlueConstants {
+    static constexpr int digits = std::numeric_limits<T>::digits;
+    static constexpr int emin = std::numeric_limits<T>::min_exponent;
+    static constexpr int emax = std::numeric_limits<T>::max_exponent;
+
+    static constexpr int floor_half(int x) { return x >= 0 ? x / 2 : -((-x + 1) / 2); }
+    static constexpr int ceil_half(int x) { return -floor_half(-x); }
+
+    static constexpr T tsml = simd::detail::pow2<T>(ceil_half(emin - 1));
+    static constexpr T tbig = simd::detail::pow2<T>(floor_half(emax - digits + 1));
+    static constexpr T ssml = simd::detail::pow2<T>(-floor_half(emin - digits));
+    static constexpr T sbig = simd::detail::pow2<T>(-ceil_half(emax + digits - 1));
+};
+
+template<concepts::FloatingPoint T>
+T blue_combine(T asml, T amed, T abig) {
+    using C = BlueConstants<T>;
+
+    if (abig > T{0}) {
+        if (amed > T{0} || std::isnan(amed)) {
+            abig += (amed * C::sbig) * C::sbig;
+        }
+        return std::sqrt(abig) / C::sbig;
+    }
+
+    if (asml > T{0}) {
+        if (amed > T{0} || std::isnan(amed)) {
+            T ymed = std::sqrt(amed);
+            T ysml = std::sqrt(asml) / C::ssml;
+            T ymin = std::min(ymed, ysml);
+            T ymax = std::max(ymed, ysml);
+            T ratio = ymin / ymax;
+            return ymax * std::sqrt(T{1} + ratio * ratio);
+        }
+        return std::sqrt(asml) / C::ssml;
+    }
+
+    return std::sqrt(amed);
+}
+
+// One pass over the data with W independent lanes: every classification is a
+// select rather than a branch so the loop body vectorizes.
+template<concepts::FloatingPoint T, bool WithL1Linf>
+NormSummary<T> norm_kernel(const T* data, std::size_t n) {
+    using C = BlueConstants<T>;
+    constexpr std::size_t W = simd::lanes<T>;
+
+    T asml[W] = {};
+    T amed[W] = {};
+    T abig[W] = {};
+    T l1[W] = {};
+    T linf[W] = {};
+    std::size_t bad[W] = {};
+
+    auto accumulate = [&](std::size_t lane, T x) {
+        T a = std::abs(x);
+        T big = a > C::tbig ? a * C::sbig : T{0};
+        T sml = a < C::tsml ? a * C::ssml : T{0};
+        T med = (a > C::tbig || a < C::tsml) ? T{0} : a;
+        abig[lane] += big * big;
+        asml[lane] += sml * sml;
+        amed[lane] += med * med;
+        if constexpr (WithL1Linf) {
+            l1[lane] += a;
+            linf[lane] = a > linf[lane] ? a : linf[lane];
+            bad[lane] += (a <= std::numeric_limits<T>::max()) ? 0 : 1;
+        }
+    };
+
+    std::size_t i = 0;
+    for (; i + W <= n; i += W) {
+        for (std::size_t lane = 0; lane < W; ++lane) {
+            accumulate(lane, data[i + lane]);
+        }
+    }
+    for (std::size_t lane = 0; i < n; ++i, ++lane) {
+        accumulate(lane, data[i]);
+    }
+
+    NormSummary<T> result{T{0}, T{0}, T{0}, 0};
+    T s = T{0}, m = T{0}, b = T{0};
+    for (std::size_t lane = 0; lane < W; ++lane) {
+        s += asml[lane];
+        m += amed[lane];
+        b += abig[lane];
+        result.l1 += l1[lane];
+        result.linf = std::max(result.linf, linf[lane]);
+        result.non_finite += bad[lane];
     }
-    return sum;
+    result.l2 = blue_combine(s, m, b);
+    return result;
+}
+
+template<int P, typename T>
+constexpr T ipow(T x) {
+    if constexpr (P == 0) {
+        return T{1};
+    } else if constexpr (P == 1) {
+        return x;
+    } else {
+        T half = ipow<P / 2>(x);
+        if constexpr (P % 2 == 0) {
+            return half * half;
+        } else {
+            return half * half * x;
+        }
+    }
+}
+
+}
+
+// L1, overflow-safe L2, Linf and the number of non-finite entries in a
+// single sweep.
+template<concepts::FloatingPoint T>
+NormSummary<T> norms(std::span<const T> v) {
+    return detail::norm_kernel<T, true>(v.data(), v.size());
+}
+
+template<concepts::FloatingPoint T, std::size_t N>
+NormSummary<T> norms(const Vector<T, N>& v) {
+    return detail::norm_kernel<T, true>(v.data(), N);
+}
+
+template<concepts::FloatingPoint T>
+T l2_norm(std::span<const T> v) {
+    return detail::norm_kernel<T, false>(v.data(), v.size()).l2;
+}
+
+template<concepts::Arithmetic T, summation::SummationPolicy S = summation::pairwise_t>
+T l1_norm(std::span<const T> v, S policy = {}) {
+    return summation::transform_sum<T>(0, v.size(), [v](std::size_t i) { return std::abs(v[i]); }, policy);
+}
+
+template<concepts::Arithmetic T, std::size_t N, summation::SummationPolicy S = summation::pairwise_t>
+T l1_norm(const Vector<T, N>& v, S policy = {}) {
+    return l1_norm(std::span<const T>(v.data(), N), policy);
 }
 
 template<concepts::Arithmetic T, std::size_t N>
 T l2_norm(const Vector<T, N>& v) {
-    return v.norm();
+    if constexpr (concepts::FloatingPoint<T>) {
+        return detail::norm_kernel<T, false>(v.data(), N).l2;
+    } else {
+        return v.norm();
+    }
 }
 
 template<concepts::Arithmetic T, std::size_t N>
@@ -32,25 +182,32 @@ T linf_norm(const Vector<T, N>& v) {
     return max_val;
 }
 
-template<concepts::Arithmetic T, std::size_t N, int P>
-T lp_norm(const Vector<T, N>& v) {
+template<concepts::Arithmetic T, std::size_t N, int P, summation::SummationPolicy S = summation::pairwise_t>
+T lp_norm(const Vector<T, N>& v, S policy = {}) {
     static_assert(P > 0, "p must be positive");
-    T sum = T{0};
-    for (std::size_t i = 0; i < N; ++i) {
-        sum += std::pow(std::abs(v[i]), P);
+    T sum = summation::transform_sum<T>(0, N, [&v](std::size_t i) {
+        return detail::ipow<P>(std::abs(v[i]));
+    }, policy);
+    if constexpr (P == 1) {
+        return sum;
+    } else if constexpr (P == 2) {
+        return std::sqrt(sum);
+    } else {
+        return std::pow(sum, T{1} / P);
     }
-    return std::pow(sum, T{1} / P);
 }
 
 template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
 T frobenius_norm(const Matrix<T, Rows, Cols>& m) {
-    T sum = T{0};
-    for (std::size_t i = 0; i < Rows; ++i) {
-        for (std::size_t j = 0; j < Cols; ++j) {
-            sum += m(i, j) * m(i, j);
+    if constexpr (concepts::FloatingPoint<T>) {
+        return detail::norm_kernel<T, false>(m.data(), Rows * Cols).l2;
+    } else {
+        T sum = T{0};
+        for (std::size_t k = 0; k < Rows * Cols; ++k) {
+            sum += m.data()[k] * m.data()[k];
         }
+        return std::sqrt(sum);
     }
-    return std::sqrt(sum);
 }
 
 template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
@@ -68,10 +225,9 @@ template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
 T matrix_1_norm(const Matrix<T, Rows, Cols>& m) {
     T max_col_sum = T{0};
     for (std::size_t j = 0; j < Cols; ++j) {
-        T col_sum = T{0};
-        for (std::size_t i = 0; i < Rows; ++i) {
-            col_sum += std::abs(m(i, j));
-        }
+        T col_sum = summation::transform_sum<T>(0, Rows, [&m, j](std::size_t i) {
+            return std::abs(m(i, j));
+        }, summation::pairwise);
         max_col_sum = std::max(max_col_sum, col_sum);
     }
     return max_col_sum;
@@ -81,10 +237,9 @@ template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
 T matrix_inf_norm(const Matrix<T, Rows, Cols>& m) {
     T max_row_sum = T{0};
     for (std::size_t i = 0; i < Rows; ++i) {
-        T row_sum = T{0};
-        for (std::size_t j = 0; j < Cols; ++j) {
-            row_sum += std::abs(m(i, j));
-        }
+        T row_sum = summation::transform_sum<T>(0, Cols, [&m, i](std::size_t j) {
+            return std::abs(m(i, j));
+        }, summation::pairwise);
         max_row_sum = std::max(max_row_sum, row_sum);
     }
     return max_row_sum;
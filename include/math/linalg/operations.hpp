@@ -3,14 +3,112 @@
 
 #include "../core/matrix.hpp"
 #include "../core/vector.hpp"
+#include "../exec/parallel.hpp"
+#include "../exec/policy.hpp"
+#include "../exec/reduce.hpp"
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace math::linalg {
 
+namespace detail {
+
+template<concepts::Arithmetic T>
+constexpr T abs_value(T x) {
+    return x < T{0} ? -x : x;
+}
+
+// 2x2 minors of the top two rows (s) and bottom two rows (c) of a 4x4;
+// the determinant and every cofactor are built from these twelve values.
+template<concepts::Arithmetic T>
+struct Minors4 {
+    T s[6];
+    T c[6];
+
+    constexpr explicit Minors4(const Matrix<T, 4, 4>& m)
+        : s{m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1),
+            m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2),
+            m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3),
+            m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2),
+            m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3),
+            m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3)},
+          c{m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1),
+            m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2),
+            m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3),
+            m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2),
+            m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3),
+            m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3)} {}
+
+    constexpr T determinant() const {
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+};
+
+// Product of row infinity norms. This is not a bound on |det| (for
+// [[1, 1], [-1, 1]] it is 1 against a determinant of 2); it only supplies
+// the scale the singularity test compares |det| with, so that scaling a
+// row scales both sides alike.
+template<concepts::Arithmetic T, std::size_t N>
+constexpr T row_norm_product(const Matrix<T, N, N>& m) {
+    T product = T{1};
+    for (std::size_t i = 0; i < N; ++i) {
+        T row_max = T{0};
+        for (std::size_t j = 0; j < N; ++j) {
+            T a = abs_value(m(i, j));
+            row_max = a > row_max ? a : row_max;
+        }
+        product *= row_max;
+    }
+    return product;
+}
+
+}
+
 template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
 constexpr Matrix<T, Cols, Rows> transpose(const Matrix<T, Rows, Cols>& m) {
     return m.transpose();
 }
 
+// Row-parallel product; each task computes whole rows of the result with
+// an i-k-j loop so the inner loop streams contiguous rows of B.
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T, std::size_t Rows, std::size_t Inner, std::size_t Cols>
+Matrix<T, Rows, Cols> multiply(const Policy& policy, const Matrix<T, Rows, Inner>& a, const Matrix<T, Inner, Cols>& b) {
+    if constexpr (!exec::ParallelPolicy<Policy>) {
+        return a * b;
+    } else {
+        Matrix<T, Rows, Cols> result;
+        constexpr std::size_t row_work = Inner * Cols;
+        constexpr std::size_t min_rows = row_work >= 4096 ? 1 : 4096 / row_work;
+        exec::parallel_for(policy, 0, Rows, min_rows, [&](std::size_t r0, std::size_t r1) {
+            for (std::size_t i = r0; i < r1; ++i) {
+                for (std::size_t k = 0; k < Inner; ++k) {
+                    T aik = a(i, k);
+                    for (std::size_t j = 0; j < Cols; ++j) {
+                        result(i, j) += aik * b(k, j);
+                    }
+                }
+            }
+        });
+        return result;
+    }
+}
+
+// Policy-selected dot product. A fixed-size Vector never leaves the calling
+// thread: par_simd uses the lane-blocked kernel and deterministic uses the
+// same blocks and pairwise tree as exec::deterministic reductions over spans.
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T, std::size_t N>
+T dot(const Policy&, const Vector<T, N>& a, const Vector<T, N>& b) {
+    auto term = [&a, &b](std::size_t i) { return a[i] * b[i]; };
+    if constexpr (exec::DeterministicPolicy<Policy>) {
+        return exec::deterministic_sum<T>(0, N, term);
+    } else if constexpr (std::is_same_v<std::remove_cvref_t<Policy>, exec::parallel_simd_policy>) {
+        return exec::lane_sum<T>(0, N, term);
+    } else {
+        return a.dot(b);
+    }
+}
+
 template<concepts::Arithmetic T, std::size_t N>
 constexpr T trace(const Matrix<T, N, N>& m) {
     return m.trace();
@@ -26,6 +124,8 @@ constexpr T determinant(const Matrix<T, N, N>& m) {
         return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
              - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
              + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+    } else if constexpr (N == 4) {
+        return detail::Minors4<T>(m).determinant();
     } else {
         T det = T{0};
         for (std::size_t j = 0; j < N; ++j) {
@@ -76,6 +176,181 @@ constexpr Matrix<T, 3, 3> inverse(const Matrix<T, 3, 3>& m) {
     return result;
 }
 
+// Cofactor (adjugate) inverse built from the twelve 2x2 minors: 12 + 6
+// products for the determinant and 48 for the adjugate, all independent
+// straight-line expressions the compiler can pack into vector registers.
+template<concepts::Arithmetic T>
+constexpr Matrix<T, 4, 4> inverse(const Matrix<T, 4, 4>& m) {
+    detail::Minors4<T> k(m);
+    const T* s = k.s;
+    const T* c = k.c;
+    T inv_det = T{1} / k.determinant();
+
+    Matrix<T, 4, 4> r;
+    r(0, 0) = ( m(1, 1) * c[5] - m(1, 2) * c[4] + m(1, 3) * c[3]) * inv_det;
+    r(0, 1) = (-m(0, 1) * c[5] + m(0, 2) * c[4] - m(0, 3) * c[3]) * inv_det;
+    r(0, 2) = ( m(3, 1) * s[5] - m(3, 2) * s[4] + m(3, 3) * s[3]) * inv_det;
+    r(0, 3) = (-m(2, 1) * s[5] + m(2, 2) * s[4] - m(2, 3) * s[3]) * inv_det;
+
+    r(1, 0) = (-m(1, 0) * c[5] + m(1, 2) * c[2] - m(1, 3) * c[1]) * inv_det;
+    r(1, 1) = ( m(0, 0) * c[5] - m(0, 2) * c[2] + m(0, 3) * c[1]) * inv_det;
+    r(1, 2) = (-m(3, 0) * s[5] + m(3, 2) * s[2] - m(3, 3) * s[1]) * inv_det;
+    r(1, 3) = ( m(2, 0) * s[5] - m(2, 2) * s[2] + m(2, 3) * s[1]) * inv_det;
+
+    r(2, 0) = ( m(1, 0) * c[4] - m(1, 1) * c[2] + m(1, 3) * c[0]) * inv_det;
+    r(2, 1) = (-m(0, 0) * c[4] + m(0, 1) * c[2] - m(0, 3) * c[0]) * inv_det;
+    r(2, 2) = ( m(3, 0) * s[4] - m(3, 1) * s[2] + m(3, 3) * s[0]) * inv_det;
+    r(2, 3) = (-m(2, 0) * s[4] + m(2, 1) * s[2] - m(2, 3) * s[0]) * inv_det;
+
+    r(3, 0) = (-m(1, 0) * c[3] + m(1, 1) * c[1] - m(1, 2) * c[0]) * inv_det;
+    r(3, 1) = ( m(0, 0) * c[3] - m(0, 1) * c[1] + m(0, 2) * c[0]) * inv_det;
+    r(3, 2) = (-m(3, 0) * s[3] + m(3, 1) * s[1] - m(3, 2) * s[0]) * inv_det;
+    r(3, 3) = ( m(2, 0) * s[3] - m(2, 1) * s[1] + m(2, 2) * s[0]) * inv_det;
+
+    return r;
+}
+
+// Rotation-only matrices: the inverse is the transpose.
+template<concepts::Arithmetic T, std::size_t N>
+constexpr Matrix<T, N, N> inverse_orthonormal(const Matrix<T, N, N>& m) {
+    return m.transpose();
+}
+
+// Homogeneous affine matrices (last row 0 0 0 1): invert the 3x3 block and
+// map the translation through it.
+template<concepts::Arithmetic T>
+constexpr Matrix<T, 4, 4> inverse_affine(const Matrix<T, 4, 4>& m) {
+    Matrix<T, 3, 3> linear;
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            linear(i, j) = m(i, j);
+        }
+    }
+    auto linear_inv = inverse(linear);
+
+    Matrix<T, 4, 4> r;
+    for (std::size_t i = 0; i < 3; ++i) {
+        T t = T{0};
+        for (std::size_t j = 0; j < 3; ++j) {
+            r(i, j) = linear_inv(i, j);
+            t -= linear_inv(i, j) * m(j, 3);
+        }
+        r(i, 3) = t;
+    }
+    r(3, 3) = T{1};
+    return r;
+}
+
+// Rigid affine matrices (orthonormal 3x3 block): transpose plus -R^T t.
+template<concepts::Arithmetic T>
+constexpr Matrix<T, 4, 4> inverse_rigid(const Matrix<T, 4, 4>& m) {
+    Matrix<T, 4, 4> r;
+    for (std::size_t i = 0; i < 3; ++i) {
+        T t = T{0};
+        for (std::size_t j = 0; j < 3; ++j) {
+            r(i, j) = m(j, i);
+            t -= m(j, i) * m(j, 3);
+        }
+        r(i, 3) = t;
+    }
+    r(3, 3) = T{1};
+    return r;
+}
+
+template<concepts::Arithmetic T, std::size_t N>
+struct SmallInverse {
+    Matrix<T, N, N> inverse;
+    T determinant;
+    bool singular;
+};
+
+// Checked inverse for fixed sizes up to 6x6. Sizes 2-4 use the closed
+// forms above; 5 and 6 use Gauss-Jordan with partial pivoting whose loop
+// bounds are compile-time constants, so it fully unrolls. The matrix is
+// reported singular when |det| falls below 100 epsilon times the product
+// of the row norms, which does not depend on the overall scale of the
+// matrix. That is a determinant test, stricter than the pivot test of
+// lu_decompose: badly conditioned but invertible matrices (a 6x6 Hilbert
+// matrix, say) are reported singular here, while matrix_inverse, which
+// uses LU, still inverts them.
+template<concepts::FloatingPoint T, std::size_t N>
+    requires (N <= 6)
+constexpr SmallInverse<T, N> small_inverse(const Matrix<T, N, N>& m) {
+    constexpr T tolerance = std::numeric_limits<T>::epsilon() * T{100};
+    T scale = detail::row_norm_product(m);
+
+    SmallInverse<T, N> result{Matrix<T, N, N>::zeros(), T{0}, true};
+
+    if constexpr (N <= 4) {
+        T det = determinant(m);
+        result.determinant = det;
+        if (scale == T{0} || detail::abs_value(det) <= tolerance * scale) {
+            return result;
+        }
+        if constexpr (N == 1) {
+            result.inverse(0, 0) = T{1} / det;
+        } else {
+            result.inverse = inverse(m);
+        }
+        result.singular = false;
+        return result;
+    } else {
+        Matrix<T, N, N> a = m;
+        Matrix<T, N, N> inv = Matrix<T, N, N>::identity();
+        T det = T{1};
+
+        for (std::size_t k = 0; k < N; ++k) {
+            std::size_t pivot_row = k;
+            T max_val = detail::abs_value(a(k, k));
+            for (std::size_t i = k + 1; i < N; ++i) {
+                T val = detail::abs_value(a(i, k));
+                if (val > max_val) {
+                    max_val = val;
+                    pivot_row = i;
+                }
+            }
+
+            if (max_val == T{0}) {
+                result.determinant = T{0};
+                return result;
+            }
+
+            if (pivot_row != k) {
+                for (std::size_t j = 0; j < N; ++j) {
+                    std::swap(a(k, j), a(pivot_row, j));
+                    std::swap(inv(k, j), inv(pivot_row, j));
+                }
+                det = -det;
+            }
+
+            T pivot = a(k, k);
+            det *= pivot;
+            T inv_pivot = T{1} / pivot;
+            for (std::size_t j = 0; j < N; ++j) {
+                a(k, j) *= inv_pivot;
+                inv(k, j) *= inv_pivot;
+            }
+
+            for (std::size_t i = 0; i < N; ++i) {
+                if (i == k) continue;
+                T factor = a(i, k);
+                for (std::size_t j = 0; j < N; ++j) {
+                    a(i, j) -= factor * a(k, j);
+                    inv(i, j) -= factor * inv(k, j);
+                }
+            }
+        }
+
+        result.determinant = det;
+        if (detail::abs_value(det) <= tolerance * scale) {
+            return result;
+        }
+        result.inverse = inv;
+        result.singular = false;
+        return result;
+    }
+}
+
 }
 
 #endif
@@ -0,0 +1,276 @@
+#ifndef MATH_LINALG_OPERATOR_HPP
+#define MATH_LINALG_OPERATOR_HPP
+
+#include "../core/concepts/linalg.hpp"
+#include "../core/matrix.hpp"
+#include "../core/vector.hpp"
+
+namespace math::linalg {
+
+// Matrix-free operators: anything exposing apply/apply_transpose on a fixed
+// size Vector satisfies concepts::LinearOperator and can be handed to the
+// eigensolvers and Krylov solvers without materializing a Matrix.
+//
+// MatrixOperator and GramOperator refer to the matrix they wrap rather than
+// copying it, so binding them to a temporary is rejected at compile time.
+
+template<concepts::Arithmetic T, std::size_t N>
+class MatrixOperator {
+    const Matrix<T, N, N>* m_;
+
+public:
+    using value_type = T;
+    using vector_type = Vector<T, N>;
+
+    explicit constexpr MatrixOperator(const Matrix<T, N, N>& m) : m_(&m) {}
+    explicit MatrixOperator(const Matrix<T, N, N>&&) = delete;
+
+    constexpr std::size_t rows() const { return N; }
+    constexpr std::size_t cols() const { return N; }
+
+    constexpr vector_type apply(const vector_type& x) const {
+        return (*m_) * x;
+    }
+
+    constexpr vector_type apply_transpose(const vector_type& x) const {
+        vector_type result;
+        for (std::size_t i = 0; i < N; ++i) {
+            T xi = x[i];
+            for (std::size_t j = 0; j < N; ++j) {
+                result[j] += (*m_)(i, j) * xi;
+            }
+        }
+        return result;
+    }
+
+    constexpr vector_type diagonal() const {
+        vector_type result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result[i] = (*m_)(i, i);
+        }
+        return result;
+    }
+
+    constexpr bool symmetric() const {
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = i + 1; j < N; ++j) {
+                if ((*m_)(i, j) != (*m_)(j, i)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+template<concepts::LinearOperator Op>
+class ShiftedOperator {
+    Op op_;
+    typename Op::value_type sigma_;
+
+public:
+    using value_type = typename Op::value_type;
+    using vector_type = typename Op::vector_type;
+
+    constexpr ShiftedOperator(Op op, value_type sigma) : op_(op), sigma_(sigma) {}
+
+    constexpr std::size_t rows() const { return op_.rows(); }
+    constexpr std::size_t cols() const { return op_.cols(); }
+
+    constexpr vector_type apply(const vector_type& x) const {
+        return op_.apply(x) - x * sigma_;
+    }
+
+    constexpr vector_type apply_transpose(const vector_type& x) const {
+        return op_.apply_transpose(x) - x * sigma_;
+    }
+
+    constexpr vector_type diagonal() const requires concepts::DiagonalOperator<Op> {
+        auto d = op_.diagonal();
+        for (std::size_t i = 0; i < d.size(); ++i) {
+            d[i] -= sigma_;
+        }
+        return d;
+    }
+
+    constexpr bool symmetric() const requires concepts::SymmetryAwareOperator<Op> {
+        return op_.symmetric();
+    }
+};
+
+// A^T A applied as two products; never forms the Gram matrix.
+template<concepts::LinearOperator Op>
+class NormalOperator {
+    Op op_;
+
+public:
+    using value_type = typename Op::value_type;
+    using vector_type = typename Op::vector_type;
+
+    explicit constexpr NormalOperator(Op op) : op_(op) {}
+
+    constexpr std::size_t rows() const { return op_.cols(); }
+    constexpr std::size_t cols() const { return op_.cols(); }
+
+    constexpr vector_type apply(const vector_type& x) const {
+        return op_.apply_transpose(op_.apply(x));
+    }
+
+    constexpr vector_type apply_transpose(const vector_type& x) const {
+        return apply(x);
+    }
+
+    constexpr bool symmetric() const { return true; }
+};
+
+// A^T A for a rectangular A, acting on the column space.
+template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
+class GramOperator {
+    const Matrix<T, Rows, Cols>* m_;
+
+public:
+    using value_type = T;
+    using vector_type = Vector<T, Cols>;
+
+    explicit constexpr GramOperator(const Matrix<T, Rows, Cols>& m) : m_(&m) {}
+    explicit GramOperator(const Matrix<T, Rows, Cols>&&) = delete;
+
+    constexpr std::size_t rows() const { return Cols; }
+    constexpr std::size_t cols() const { return Cols; }
+
+    constexpr vector_type apply(const vector_type& x) const {
+        auto ax = (*m_) * x;
+        vector_type result;
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                result[j] += (*m_)(i, j) * ax[i];
+            }
+        }
+        return result;
+    }
+
+    constexpr vector_type apply_transpose(const vector_type& x) const {
+        return apply(x);
+    }
+
+    constexpr vector_type diagonal() const {
+        vector_type result;
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                result[j] += (*m_)(i, j) * (*m_)(i, j);
+            }
+        }
+        return result;
+    }
+
+    constexpr bool symmetric() const { return true; }
+};
+
+// (A kron B) x evaluated as A X B^T on the row-major reshape X of x.
+template<concepts::LinearOperator OpA, concepts::LinearOperator OpB>
+    requires std::same_as<typename OpA::value_type, typename OpB::value_type>
+class KroneckerOperator {
+    OpA a_;
+    OpB b_;
+
+    static constexpr std::size_t NA = OpA::vector_type::size_value;
+    static constexpr std::size_t NB = OpB::vector_type::size_value;
+
+public:
+    using value_type = typename OpA::value_type;
+    using vector_type = Vector<value_type, NA * NB>;
+
+    constexpr KroneckerOperator(OpA a, OpB b) : a_(a), b_(b) {}
+
+    constexpr std::size_t rows() const { return NA * NB; }
+    constexpr std::size_t cols() const { return NA * NB; }
+
+    constexpr vector_type apply(const vector_type& x) const {
+        return apply_impl(x, false);
+    }
+
+    constexpr vector_type apply_transpose(const vector_type& x) const {
+        return apply_impl(x, true);
+    }
+
+    constexpr vector_type diagonal() const
+        requires concepts::DiagonalOperator<OpA> && concepts::DiagonalOperator<OpB> {
+        auto da = a_.diagonal();
+        auto db = b_.diagonal();
+        vector_type result;
+        for (std::size_t i = 0; i < NA; ++i) {
+            for (std::size_t j = 0; j < NB; ++j) {
+                result[i * NB + j] = da[i] * db[j];
+            }
+        }
+        return result;
+    }
+
+    constexpr bool symmetric() const
+        requires concepts::SymmetryAwareOperator<OpA> && concepts::SymmetryAwareOperator<OpB> {
+        return a_.symmetric() && b_.symmetric();
+    }
+
+private:
+    constexpr vector_type apply_impl(const vector_type& x, bool transposed) const {
+        vector_type z;
+        for (std::size_t i = 0; i < NA; ++i) {
+            typename OpB::vector_type row;
+            for (std::size_t j = 0; j < NB; ++j) {
+                row[j] = x[i * NB + j];
+            }
+            row = transposed ? b_.apply_transpose(row) : b_.apply(row);
+            for (std::size_t j = 0; j < NB; ++j) {
+                z[i * NB + j] = row[j];
+            }
+        }
+
+        vector_type result;
+        for (std::size_t j = 0; j < NB; ++j) {
+            typename OpA::vector_type col;
+            for (std::size_t i = 0; i < NA; ++i) {
+                col[i] = z[i * NB + j];
+            }
+            col = transposed ? a_.apply_transpose(col) : a_.apply(col);
+            for (std::size_t i = 0; i < NA; ++i) {
+                result[i * NB + j] = col[i];
+            }
+        }
+        return result;
+    }
+};
+
+template<concepts::Arithmetic T, std::size_t N>
+constexpr MatrixOperator<T, N> make_operator(const Matrix<T, N, N>& m) {
+    return MatrixOperator<T, N>(m);
+}
+
+template<concepts::Arithmetic T, std::size_t N>
+void make_operator(const Matrix<T, N, N>&&) = delete;
+
+template<concepts::LinearOperator Op>
+constexpr ShiftedOperator<Op> shifted(Op op, typename Op::value_type sigma) {
+    return ShiftedOperator<Op>(op, sigma);
+}
+
+template<concepts::LinearOperator Op>
+constexpr NormalOperator<Op> normal(Op op) {
+    return NormalOperator<Op>(op);
+}
+
+template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
+constexpr GramOperator<T, Rows, Cols> gram(const Matrix<T, Rows, Cols>& m) {
+    return GramOperator<T, Rows, Cols>(m);
+}
+
+template<concepts::Arithmetic T, std::size_t Rows, std::size_t Cols>
+void gram(const Matrix<T, Rows, Cols>&&) = delete;
+
+template<concepts::LinearOperator OpA, concepts::LinearOperator OpB>
+constexpr KroneckerOperator<OpA, OpB> kronecker(OpA a, OpB b) {
+    return KroneckerOperator<OpA, OpB>(a, b);
+}
+
+}
+
+#endif
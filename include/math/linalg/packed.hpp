@@ -0,0 +1,183 @@
+#ifndef MATH_LINALG_PACKED_HPP
+#define MATH_LINALG_PACKED_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace math::linalg {
+
+// Lower triangle packed row by row: element (i, j), j <= i, lives at
+// i * (i + 1) / 2 + j. Half the memory of dense storage.
+template<concepts::FloatingPoint T>
+class PackedLowerTriangular {
+    std::size_t n_;
+    std::vector<T> data_;
+
+public:
+    using value_type = T;
+
+    explicit PackedLowerTriangular(std::size_t n) : n_(n), data_(n * (n + 1) / 2) {}
+
+    std::size_t size() const { return n_; }
+    std::size_t rows() const { return n_; }
+    std::size_t cols() const { return n_; }
+
+    static constexpr std::size_t index(std::size_t i, std::size_t j) {
+        return i * (i + 1) / 2 + j;
+    }
+
+    // Only valid for j <= i.
+    T& operator()(std::size_t i, std::size_t j) { return data_[index(i, j)]; }
+
+    T operator()(std::size_t i, std::size_t j) const {
+        return j <= i ? data_[index(i, j)] : T{0};
+    }
+
+    std::span<T> packed() { return data_; }
+    std::span<const T> packed() const { return data_; }
+};
+
+// Symmetric matrix stored as its packed lower triangle.
+template<concepts::FloatingPoint T>
+class PackedSymmetric {
+    PackedLowerTriangular<T> lower_;
+
+public:
+    using value_type = T;
+
+    explicit PackedSymmetric(std::size_t n) : lower_(n) {}
+
+    std::size_t size() const { return lower_.size(); }
+    std::size_t rows() const { return lower_.size(); }
+    std::size_t cols() const { return lower_.size(); }
+
+    T& operator()(std::size_t i, std::size_t j) {
+        return j <= i ? lower_(i, j) : lower_(j, i);
+    }
+
+    T operator()(std::size_t i, std::size_t j) const {
+        return j <= i ? lower_(i, j) : lower_(j, i);
+    }
+
+    std::span<T> packed() { return lower_.packed(); }
+    std::span<const T> packed() const { return lower_.packed(); }
+
+    std::vector<T> operator*(std::span<const T> x) const {
+        std::size_t n = size();
+        std::vector<T> y(n, T{0});
+        auto p = packed();
+        for (std::size_t i = 0; i < n; ++i) {
+            const T* row = p.data() + PackedLowerTriangular<T>::index(i, 0);
+            T sum = T{0};
+            for (std::size_t j = 0; j < i; ++j) {
+                sum += row[j] * x[j];
+                y[j] += row[j] * x[i];
+            }
+            y[i] += sum + row[i] * x[i];
+        }
+        return y;
+    }
+};
+
+template<concepts::FloatingPoint T>
+std::optional<std::vector<T>> forward_substitution(const PackedLowerTriangular<T>& L, std::span<const T> b) {
+    std::size_t n = L.size();
+    if (b.size() != n) {
+        return std::nullopt;
+    }
+
+    std::vector<T> x(n);
+    auto p = L.packed();
+    for (std::size_t i = 0; i < n; ++i) {
+        const T* row = p.data() + PackedLowerTriangular<T>::index(i, 0);
+        T sum = b[i];
+        for (std::size_t j = 0; j < i; ++j) {
+            sum -= row[j] * x[j];
+        }
+        x[i] = sum / row[i];
+    }
+    return x;
+}
+
+// Solves L^T x = b using the packed lower factor; a column sweep keeps the
+// access pattern row-contiguous.
+template<concepts::FloatingPoint T>
+std::optional<std::vector<T>> backward_substitution_transposed(const PackedLowerTriangular<T>& L,
+                                                               std::span<const T> b) {
+    std::size_t n = L.size();
+    if (b.size() != n) {
+        return std::nullopt;
+    }
+
+    std::vector<T> x(b.begin(), b.end());
+    auto p = L.packed();
+    for (std::size_t i = n; i-- > 0; ) {
+        const T* row = p.data() + PackedLowerTriangular<T>::index(i, 0);
+        x[i] /= row[i];
+        T xi = x[i];
+        for (std::size_t j = 0; j < i; ++j) {
+            x[j] -= row[j] * xi;
+        }
+    }
+    return x;
+}
+
+template<concepts::FloatingPoint T>
+struct PackedCholesky {
+    PackedLowerTriangular<T> L;
+    bool positive_definite;
+};
+
+template<concepts::FloatingPoint T>
+PackedCholesky<T> cholesky_decompose(const PackedSymmetric<T>& A) {
+    std::size_t n = A.size();
+    PackedCholesky<T> result{PackedLowerTriangular<T>(n), true};
+
+    constexpr T epsilon = std::numeric_limits<T>::epsilon() * T{100};
+    auto p = result.L.packed();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        T* row_i = p.data() + PackedLowerTriangular<T>::index(i, 0);
+        for (std::size_t j = 0; j <= i; ++j) {
+            const T* row_j = p.data() + PackedLowerTriangular<T>::index(j, 0);
+            T sum = A(i, j);
+            for (std::size_t k = 0; k < j; ++k) {
+                sum -= row_i[k] * row_j[k];
+            }
+
+            if (j == i) {
+                if (sum <= epsilon) {
+                    result.positive_definite = false;
+                    return result;
+                }
+                row_i[i] = std::sqrt(sum);
+            } else {
+                row_i[j] = sum / row_j[j];
+            }
+        }
+    }
+
+    return result;
+}
+
+template<concepts::FloatingPoint T>
+std::optional<std::vector<T>> solve_cholesky(const PackedSymmetric<T>& A, std::span<const T> b) {
+    auto chol = cholesky_decompose(A);
+    if (!chol.positive_definite) {
+        return std::nullopt;
+    }
+
+    auto y = forward_substitution(chol.L, b);
+    if (!y) {
+        return std::nullopt;
+    }
+    return backward_substitution_transposed(chol.L, std::span<const T>(*y));
+}
+
+}
+
+#endif
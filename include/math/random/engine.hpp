@@ -0,0 +1,335 @@
+#ifndef MATH_RANDOM_ENGINE_HPP
+#define MATH_RANDOM_ENGINE_HPP
+
+#include "../core/simd.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+
+namespace math::random {
+
+// Every engine produces 64-bit words and models
+// std::uniform_random_bit_generator, so the <random> distributions accept
+// it too. Engines with a generate(span) member fill whole buffers in a loop
+// the compiler vectorizes; generate() below falls back to repeated calls.
+template<typename G>
+concept BitGenerator = std::uniform_random_bit_generator<G>
+                    && std::same_as<typename G::result_type, std::uint64_t>;
+
+namespace detail {
+
+constexpr std::uint64_t rotl(std::uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+}
+
+// Steele, Lea and Flood's SplitMix64. Used to expand a 64-bit seed into
+// the state of the larger engines; every seed, including 0, is valid.
+class SplitMix64 {
+    std::uint64_t state_;
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit constexpr SplitMix64(std::uint64_t seed = 0) : state_(seed) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    constexpr result_type operator()() {
+        std::uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    // SplitMix64(state()) continues the same sequence.
+    constexpr std::uint64_t state() const { return state_; }
+};
+
+// Blackman and Vigna's xoshiro256++: 256 bits of state, period 2^256 - 1.
+// jump() advances by 2^128 outputs and long_jump() by 2^192, so
+// non-overlapping per-thread streams come from copies of one seeded engine
+// jumped 0, 1, 2, ... times.
+class Xoshiro256pp {
+    std::array<std::uint64_t, 4> s_;
+
+    constexpr void advance(const std::array<std::uint64_t, 4>& poly) {
+        std::array<std::uint64_t, 4> t{};
+        for (std::uint64_t word : poly) {
+            for (int b = 0; b < 64; ++b) {
+                if (word & (std::uint64_t{1} << b)) {
+                    for (std::size_t i = 0; i < 4; ++i) {
+                        t[i] ^= s_[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        s_ = t;
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit constexpr Xoshiro256pp(std::uint64_t seed = 0) : s_{} {
+        SplitMix64 mix(seed);
+        for (auto& word : s_) {
+            word = mix();
+        }
+    }
+
+    // Raw state; it must not be all zero.
+    explicit constexpr Xoshiro256pp(const std::array<std::uint64_t, 4>& state) : s_(state) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    constexpr const std::array<std::uint64_t, 4>& state() const { return s_; }
+
+    constexpr result_type operator()() {
+        std::uint64_t result = detail::rotl(s_[0] + s_[3], 23) + s_[0];
+        std::uint64_t t = s_[1] << 17;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3] = detail::rotl(s_[3], 45);
+        return result;
+    }
+
+    constexpr void discard(std::uint64_t n) {
+        for (; n > 0; --n) {
+            (*this)();
+        }
+    }
+
+    constexpr void jump() {
+        advance({0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL});
+    }
+
+    constexpr void long_jump() {
+        advance({0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL});
+    }
+
+    friend constexpr bool operator==(const Xoshiro256pp&, const Xoshiro256pp&) = default;
+};
+
+// W xoshiro256++ streams advanced in lockstep, stored by word so one step
+// of all lanes is a handful of vector instructions. Lane k starts from the
+// seed engine jumped k times; generate() interleaves the lanes, writing
+// lane k's j-th output to out[j W + k].
+template<std::size_t W = simd::lanes<std::uint64_t>>
+class Xoshiro256ppLanes {
+    static_assert(W > 0);
+
+    alignas(32) std::uint64_t s0_[W];
+    alignas(32) std::uint64_t s1_[W];
+    alignas(32) std::uint64_t s2_[W];
+    alignas(32) std::uint64_t s3_[W];
+    std::uint64_t buffer_[W];
+    std::size_t index_ = W;
+
+    void step(std::uint64_t* out) {
+        for (std::size_t k = 0; k < W; ++k) {
+            out[k] = detail::rotl(s0_[k] + s3_[k], 23) + s0_[k];
+            std::uint64_t t = s1_[k] << 17;
+            s2_[k] ^= s0_[k];
+            s3_[k] ^= s1_[k];
+            s1_[k] ^= s2_[k];
+            s0_[k] ^= s3_[k];
+            s2_[k] ^= t;
+            s3_[k] = detail::rotl(s3_[k], 45);
+        }
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr std::size_t lanes = W;
+
+    explicit Xoshiro256ppLanes(std::uint64_t seed = 0) : Xoshiro256ppLanes(Xoshiro256pp(seed)) {}
+
+    explicit Xoshiro256ppLanes(Xoshiro256pp base) {
+        for (std::size_t k = 0; k < W; ++k) {
+            const auto& s = base.state();
+            s0_[k] = s[0];
+            s1_[k] = s[1];
+            s2_[k] = s[2];
+            s3_[k] = s[3];
+            base.jump();
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // One word at a time, in the same interleaved order as generate().
+    result_type operator()() {
+        if (index_ == W) {
+            step(buffer_);
+            index_ = 0;
+        }
+        return buffer_[index_++];
+    }
+
+    void generate(std::span<std::uint64_t> out) {
+        std::size_t i = 0;
+        std::size_t n = out.size();
+        for (; i < n && index_ < W; ++i) {
+            out[i] = buffer_[index_++];
+        }
+        for (; i + W <= n; i += W) {
+            step(out.data() + i);
+        }
+        for (; i < n; ++i) {
+            out[i] = (*this)();
+        }
+    }
+};
+
+// Salmon, Moraes, Dror and Shaw's Philox4x32-10 ("Parallel random numbers:
+// as easy as 1, 2, 3", SC 2011). A counter-based generator: block(c, k) is a
+// pure bijection of a 128-bit counter under a 64-bit key, so any position of
+// any stream is reachable in O(1).
+//
+// The counter is laid out as {position low, position high, stream low,
+// stream high}; each counter value yields two 64-bit outputs. discard() and
+// seek() move the position without generating anything.
+class Philox4x32 {
+public:
+    using result_type = std::uint64_t;
+    using counter_type = std::array<std::uint32_t, 4>;
+    using key_type = std::array<std::uint32_t, 2>;
+
+    static constexpr int rounds = 10;
+
+private:
+    key_type key_;
+    counter_type counter_;
+    std::array<std::uint64_t, 2> buffer_{};
+    unsigned index_ = 2;
+
+    static constexpr std::uint64_t join(std::uint32_t lo, std::uint32_t hi) {
+        return static_cast<std::uint64_t>(lo) | (static_cast<std::uint64_t>(hi) << 32);
+    }
+
+    constexpr void refill() {
+        counter_type r = block(counter_, key_);
+        buffer_ = {join(r[0], r[1]), join(r[2], r[3])};
+        if (++counter_[0] == 0) {
+            ++counter_[1];
+        }
+        index_ = 0;
+    }
+
+public:
+    explicit constexpr Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0)
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+          counter_{0, 0, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)} {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // The Philox4x32 bijection itself: ten rounds of two 32 x 32 -> 64-bit
+    // multiplies, with a Weyl-sequence key schedule.
+    static constexpr counter_type block(counter_type c, key_type k) {
+        constexpr std::uint64_t m0 = 0xd2511f53u;
+        constexpr std::uint64_t m1 = 0xcd9e8d57u;
+        for (int r = 0; r < rounds; ++r) {
+            std::uint64_t p0 = m0 * c[0];
+            std::uint64_t p1 = m1 * c[2];
+            c = {static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0], static_cast<std::uint32_t>(p1),
+                 static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1], static_cast<std::uint32_t>(p0)};
+            k[0] += 0x9e3779b9u;
+            k[1] += 0xbb67ae85u;
+        }
+        return c;
+    }
+
+    constexpr key_type key() const { return key_; }
+    constexpr std::uint64_t stream() const { return join(counter_[2], counter_[3]); }
+
+    // Outputs consumed so far on this stream.
+    constexpr std::uint64_t position() const {
+        return 2 * join(counter_[0], counter_[1]) - (2 - index_);
+    }
+
+    constexpr void seek(std::uint64_t n) {
+        std::uint64_t block_index = n / 2;
+        counter_[0] = static_cast<std::uint32_t>(block_index);
+        counter_[1] = static_cast<std::uint32_t>(block_index >> 32);
+        index_ = 2;
+        if (n % 2 != 0) {
+            refill();
+            index_ = 1;
+        }
+    }
+
+    constexpr void discard(std::uint64_t n) {
+        seek(position() + n);
+    }
+
+    // The same key on another stream, at position 0.
+    constexpr Philox4x32 substream(std::uint64_t stream) const {
+        Philox4x32 g = *this;
+        g.counter_ = {0, 0, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)};
+        g.index_ = 2;
+        return g;
+    }
+
+    constexpr result_type operator()() {
+        if (index_ == 2) {
+            refill();
+        }
+        return buffer_[index_++];
+    }
+
+    // Whole counters are independent, so the loop over them vectorizes.
+    void generate(std::span<std::uint64_t> out) {
+        std::size_t i = 0;
+        std::size_t n = out.size();
+        for (; i < n && index_ < 2; ++i) {
+            out[i] = buffer_[index_++];
+        }
+        std::uint64_t base = join(counter_[0], counter_[1]);
+        std::size_t blocks = (n - i) / 2;
+        std::uint64_t* dst = out.data() + i;
+        for (std::size_t b = 0; b < blocks; ++b) {
+            std::uint64_t pos = base + b;
+            counter_type r = block({static_cast<std::uint32_t>(pos), static_cast<std::uint32_t>(pos >> 32), counter_[2], counter_[3]}, key_);
+            dst[2 * b] = join(r[0], r[1]);
+            dst[2 * b + 1] = join(r[2], r[3]);
+        }
+        base += blocks;
+        counter_[0] = static_cast<std::uint32_t>(base);
+        counter_[1] = static_cast<std::uint32_t>(base >> 32);
+        for (i += 2 * blocks; i < n; ++i) {
+            out[i] = (*this)();
+        }
+    }
+
+    friend constexpr bool operator==(const Philox4x32&, const Philox4x32&) = default;
+};
+
+// Fills out with raw 64-bit words from g.
+template<BitGenerator G>
+void generate(G& g, std::span<std::uint64_t> out) {
+    if constexpr (requires { g.generate(out); }) {
+        g.generate(out);
+    } else {
+        for (auto& word : out) {
+            word = g();
+        }
+    }
+}
+
+}
+
+#endif
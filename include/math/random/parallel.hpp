@@ -0,0 +1,71 @@
+#ifndef MATH_RANDOM_PARALLEL_HPP
+#define MATH_RANDOM_PARALLEL_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include "../exec/parallel.hpp"
+#include "../exec/policy.hpp"
+#include "engine.hpp"
+#include "uniform.hpp"
+#include "ziggurat.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace math::random {
+
+// Outputs per block of a policy-driven fill.
+inline constexpr std::size_t stream_block = 4096;
+
+namespace detail {
+
+// Block b of the output is drawn from g skipped forward by b * 2^33 words
+// from its current position. Blocks are independent of one another and of
+// how they are grouped into chunks, so the result is bitwise identical for
+// seq, par and any thread count. Each block has 2^33 words available for
+// ziggurat rejections, far beyond what stream_block outputs consume. g is
+// then advanced past every block reserved, so successive fills continue
+// the stream rather than repeat it: filling n outputs and then m more is
+// the same as filling n + m at once whenever n is a multiple of
+// stream_block.
+template<exec::ExecutionPolicy P, concepts::FloatingPoint T, typename Fill>
+void blocked_fill(const P& policy, Philox4x32& g, std::span<T> out, Fill fill) {
+    std::size_t blocks = (out.size() + stream_block - 1) / stream_block;
+    std::uint64_t base = g.position();
+    exec::parallel_for(policy, 0, blocks, 16, [&](std::size_t b0, std::size_t b1) {
+        for (std::size_t b = b0; b < b1; ++b) {
+            Philox4x32 local = g;
+            local.seek(base + (static_cast<std::uint64_t>(b) << 33));
+            std::size_t begin = b * stream_block;
+            fill(local, out.subspan(begin, std::min(stream_block, out.size() - begin)));
+        }
+    });
+    g.seek(base + (static_cast<std::uint64_t>(blocks) << 33));
+}
+
+}
+
+template<exec::ExecutionPolicy P, concepts::FloatingPoint T>
+void uniform(const P& policy, Philox4x32& g, std::span<T> out, T a = T{0}, T b = T{1}) {
+    detail::blocked_fill(policy, g, out, [a, b](Philox4x32& local, std::span<T> block) {
+        uniform(local, block, a, b);
+    });
+}
+
+template<exec::ExecutionPolicy P, concepts::FloatingPoint T>
+void normal(const P& policy, Philox4x32& g, std::span<T> out, T mean = T{0}, T sigma = T{1}) {
+    detail::blocked_fill(policy, g, out, [mean, sigma](Philox4x32& local, std::span<T> block) {
+        normal(local, block, mean, sigma);
+    });
+}
+
+template<exec::ExecutionPolicy P, concepts::FloatingPoint T>
+void exponential(const P& policy, Philox4x32& g, std::span<T> out, T rate = T{1}) {
+    detail::blocked_fill(policy, g, out, [rate](Philox4x32& local, std::span<T> block) {
+        exponential(local, block, rate);
+    });
+}
+
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef MATH_RANDOM_UNIFORM_HPP
+#define MATH_RANDOM_UNIFORM_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include "engine.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace math::random {
+
+// Words are drawn into a stack buffer of this many entries and converted
+// from there, so span fills never allocate.
+inline constexpr std::size_t fill_chunk = 256;
+
+// Top bits of a random word as a uniform on [0, 1): they are OR-ed into the
+// mantissa of 1.0 and 1.0 is subtracted, which is exact. Resolution is
+// 2^-52 for double and 2^-23 for float; unlike a uint64 -> double
+// conversion this has an AVX2 vector form.
+template<concepts::FloatingPoint T>
+inline T to_unit(std::uint64_t bits) {
+    if constexpr (sizeof(T) == 4) {
+        return std::bit_cast<float>(static_cast<std::uint32_t>(bits >> 41) | 0x3f800000u) - 1.0f;
+    } else if constexpr (sizeof(T) == 8) {
+        return std::bit_cast<double>((bits >> 12) | 0x3ff0000000000000ULL) - 1.0;
+    } else {
+        return static_cast<T>(to_unit<double>(bits));
+    }
+}
+
+// Uniform on (0, 1]; safe to pass to log.
+template<concepts::FloatingPoint T>
+inline T to_open_unit(std::uint64_t bits) {
+    return T{1} - to_unit<T>(bits);
+}
+
+template<concepts::FloatingPoint T = double, BitGenerator G>
+T uniform(G& g, T a = T{0}, T b = T{1}) {
+    return a + (b - a) * to_unit<T>(g());
+}
+
+// out[i] uniform on [a, b).
+template<BitGenerator G, concepts::FloatingPoint T>
+void uniform(G& g, std::span<T> out, T a = T{0}, T b = T{1}) {
+    std::uint64_t bits[fill_chunk];
+    T width = b - a;
+    for (std::size_t i = 0; i < out.size(); i += fill_chunk) {
+        std::size_t m = std::min(fill_chunk, out.size() - i);
+        generate(g, std::span<std::uint64_t>(bits, m));
+        T* dst = out.data() + i;
+        for (std::size_t j = 0; j < m; ++j) {
+            dst[j] = a + width * to_unit<T>(bits[j]);
+        }
+    }
+}
+
+}
+
+#endif
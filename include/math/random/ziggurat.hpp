@@ -0,0 +1,224 @@
+#ifndef MATH_RANDOM_ZIGGURAT_HPP
+#define MATH_RANDOM_ZIGGURAT_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include "../core/constexpr_math.hpp"
+#include "engine.hpp"
+#include "uniform.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace math::random {
+
+namespace detail {
+
+// Marsaglia and Tsang's ziggurat ("The Ziggurat Method for Generating
+// Random Variables", 2000), with Doornik's layer layout (2005). The
+// density is covered by N layers of equal area v: x[1] = r is the start of
+// the tail, x[0] = v / f(r) widens the base layer so it also carries the
+// tail's area, and x[N] = 0. ratio[i] = x[i+1] / x[i] is the fraction of
+// layer i lying wholly under the curve, and f[i] = f(x[i]) feeds the wedge
+// test. One 64-bit word supplies both the layer (low bits) and the
+// abscissa (top 52 bits).
+template<int N>
+struct ZigguratTable {
+    static constexpr int layers = N;
+    static constexpr std::uint64_t mask = N - 1;
+
+    double x[N + 1] = {};
+    double ratio[N] = {};
+    double f[N + 1] = {};
+};
+
+// Standard normal, N = 128: r = 3.442619855899, v = 9.91256303526217e-3.
+constexpr ZigguratTable<128> make_normal_table() {
+    using math::detail::constexpr_exp;
+    using math::detail::constexpr_log;
+    using math::detail::constexpr_sqrt;
+    constexpr long double r = 3.442619855899L;
+    constexpr long double v = 9.91256303526217e-3L;
+    ZigguratTable<128> t;
+    long double xs[129] = {};
+    long double fr = constexpr_exp(-0.5L * r * r);
+    xs[0] = v / fr;
+    xs[1] = r;
+    for (int i = 2; i < 128; ++i) {
+        xs[i] = constexpr_sqrt(-2.0L * constexpr_log(v / xs[i - 1] + constexpr_exp(-0.5L * xs[i - 1] * xs[i - 1])));
+    }
+    for (int i = 0; i <= 128; ++i) {
+        t.x[i] = static_cast<double>(xs[i]);
+        t.f[i] = static_cast<double>(constexpr_exp(-0.5L * xs[i] * xs[i]));
+    }
+    for (int i = 0; i < 128; ++i) {
+        t.ratio[i] = static_cast<double>(xs[i + 1] / xs[i]);
+    }
+    return t;
+}
+
+// Standard exponential, N = 256: r = 7.69711747013104972,
+// v = 3.949659822581572e-3.
+constexpr ZigguratTable<256> make_exponential_table() {
+    using math::detail::constexpr_exp;
+    using math::detail::constexpr_log;
+    constexpr long double r = 7.69711747013104972L;
+    constexpr long double v = 3.949659822581572e-3L;
+    ZigguratTable<256> t;
+    long double xs[257] = {};
+    xs[0] = v * constexpr_exp(r);
+    xs[1] = r;
+    for (int i = 2; i < 256; ++i) {
+        xs[i] = -constexpr_log(v / xs[i - 1] + constexpr_exp(-xs[i - 1]));
+    }
+    for (int i = 0; i <= 256; ++i) {
+        t.x[i] = static_cast<double>(xs[i]);
+        t.f[i] = static_cast<double>(constexpr_exp(-xs[i]));
+    }
+    for (int i = 0; i < 256; ++i) {
+        t.ratio[i] = static_cast<double>(xs[i + 1] / xs[i]);
+    }
+    return t;
+}
+
+inline constexpr ZigguratTable<128> normal_table = make_normal_table();
+inline constexpr ZigguratTable<256> exponential_table = make_exponential_table();
+
+inline double signed_unit(std::uint64_t bits) {
+    return 2.0 * to_unit<double>(bits) - 1.0;
+}
+
+// The rectangle test alone: u x[i] when it lies wholly under the density.
+// Branch-free, so span fills evaluate it for a whole buffer at once.
+inline double normal_fast(std::uint64_t bits) {
+    return signed_unit(bits) * normal_table.x[bits & normal_table.mask];
+}
+
+inline bool normal_rejected(std::uint64_t bits) {
+    return !(std::abs(signed_unit(bits)) < normal_table.ratio[bits & normal_table.mask]);
+}
+
+inline double exponential_fast(std::uint64_t bits) {
+    return to_unit<double>(bits) * exponential_table.x[bits & exponential_table.mask];
+}
+
+inline bool exponential_rejected(std::uint64_t bits) {
+    return !(to_unit<double>(bits) < exponential_table.ratio[bits & exponential_table.mask]);
+}
+
+// The full sampler, starting from an already drawn word, so a word whose
+// rectangle test failed continues with its own wedge or tail test rather
+// than being thrown away (which would bias the output towards the
+// rectangles).
+template<BitGenerator G>
+double normal_from(std::uint64_t bits, G& g) {
+    const auto& t = normal_table;
+    for (;;) {
+        double u = signed_unit(bits);
+        std::size_t i = bits & t.mask;
+        if (std::abs(u) < t.ratio[i]) {
+            return u * t.x[i];
+        }
+        if (i == 0) {
+            // Marsaglia's tail algorithm beyond r.
+            double x;
+            double y;
+            do {
+                x = std::log(to_open_unit<double>(g())) / t.x[1];
+                y = std::log(to_open_unit<double>(g()));
+            } while (-2.0 * y < x * x);
+            return u < 0.0 ? x - t.x[1] : t.x[1] - x;
+        }
+        double x = u * t.x[i];
+        if (t.f[i + 1] + to_unit<double>(g()) * (t.f[i] - t.f[i + 1]) < std::exp(-0.5 * x * x)) {
+            return x;
+        }
+        bits = g();
+    }
+}
+
+template<BitGenerator G>
+double exponential_from(std::uint64_t bits, G& g) {
+    const auto& t = exponential_table;
+    for (;;) {
+        double u = to_unit<double>(bits);
+        std::size_t i = bits & t.mask;
+        if (u < t.ratio[i]) {
+            return u * t.x[i];
+        }
+        if (i == 0) {
+            // Memoryless tail: r plus a fresh exponential.
+            return t.x[1] - std::log(to_open_unit<double>(g()));
+        }
+        double x = u * t.x[i];
+        if (t.f[i + 1] + to_unit<double>(g()) * (t.f[i] - t.f[i + 1]) < std::exp(-x)) {
+            return x;
+        }
+        bits = g();
+    }
+}
+
+// Buffered fill: the rectangle test runs as one vectorizable sweep over a
+// chunk of words, then the few rejected entries (about 1% for the normal,
+// 1.5% for the exponential) finish through the scalar sampler, drawing
+// extra words from g. The output is exactly distributed but not the same
+// sequence as repeated scalar calls.
+template<BitGenerator G, concepts::FloatingPoint T, typename Fast, typename Rejected, typename Slow>
+void ziggurat_fill(G& g, std::span<T> out, T shift, T scale, Fast fast, Rejected rejected, Slow slow) {
+    std::uint64_t bits[fill_chunk];
+    double z[fill_chunk];
+    for (std::size_t i = 0; i < out.size(); i += fill_chunk) {
+        std::size_t m = std::min(fill_chunk, out.size() - i);
+        generate(g, std::span<std::uint64_t>(bits, m));
+        for (std::size_t j = 0; j < m; ++j) {
+            z[j] = fast(bits[j]);
+        }
+        for (std::size_t j = 0; j < m; ++j) {
+            if (rejected(bits[j])) {
+                z[j] = slow(bits[j], g);
+            }
+        }
+        T* dst = out.data() + i;
+        for (std::size_t j = 0; j < m; ++j) {
+            dst[j] = shift + scale * static_cast<T>(z[j]);
+        }
+    }
+}
+
+}
+
+// Standard normal by the ziggurat: one word, one table lookup and one
+// compare on about 99% of draws.
+template<BitGenerator G>
+double normal(G& g) {
+    return detail::normal_from(g(), g);
+}
+
+// Standard exponential (rate 1) by the ziggurat.
+template<BitGenerator G>
+double exponential(G& g) {
+    return detail::exponential_from(g(), g);
+}
+
+// out[i] ~ Normal(mean, sigma).
+template<BitGenerator G, concepts::FloatingPoint T>
+void normal(G& g, std::span<T> out, T mean = T{0}, T sigma = T{1}) {
+    detail::ziggurat_fill(g, out, mean, sigma,
+                          [](std::uint64_t bits) { return detail::normal_fast(bits); },
+                          [](std::uint64_t bits) { return detail::normal_rejected(bits); },
+                          [](std::uint64_t bits, G& gen) { return detail::normal_from(bits, gen); });
+}
+
+// out[i] ~ Exponential(rate).
+template<BitGenerator G, concepts::FloatingPoint T>
+void exponential(G& g, std::span<T> out, T rate = T{1}) {
+    detail::ziggurat_fill(g, out, T{0}, T{1} / rate,
+                          [](std::uint64_t bits) { return detail::exponential_fast(bits); },
+                          [](std::uint64_t bits) { return detail::exponential_rejected(bits); },
+                          [](std::uint64_t bits, G& gen) { return detail::exponential_from(bits, gen); });
+}
+
+}
+
+#endif
@@ -1,68 +1,446 @@
 #ifndef MATH_SPECIAL_ERF_HPP
 #define MATH_SPECIAL_ERF_HPP
 
+#include "../core/accuracy.hpp"
 #include "../core/concepts/arithmetic.hpp"
+#include "../core/polynomial.hpp"
+#include "../core/simd.hpp"
+#include <algorithm>
 #include <cmath>
+#include <concepts>
 #include <numbers>
 #include <limits>
+#include <span>
+#include <type_traits>
 
 namespace math::special {
 
+namespace detail {
+
+// Abramowitz & Stegun 7.1.26 for x >= 0, given exp(-x * x): returns
+// erfc(x) = t P(t) exp(-x^2), t = 1 / (1 + 0.3275911 x), to about 1.5e-7
+// absolute.
+template<concepts::FloatingPoint T>
+struct AbramowitzStegun {
+    static constexpr T p = T{0.3275911};
+    static constexpr Polynomial<T, 5> fit{{
+        T{0.254829592}, T{-0.284496736}, T{1.421413741}, T{-1.453152027}, T{1.061405429}
+    }};
+};
+
+template<concepts::FloatingPoint T>
+constexpr T erfc_fast_positive(T x, T exp_neg_x2) {
+    using S = AbramowitzStegun<T>;
+    T t = T{1} / (T{1} + S::p * x);
+    return t * S::fit(t) * exp_neg_x2;
+}
+
+template<concepts::FloatingPoint T>
+constexpr T erf_positive(T x, T exp_neg_x2) {
+    return T{1} - erfc_fast_positive(x, exp_neg_x2);
+}
+
+// W. J. Cody's rational approximations (CALERF, Math. Comp. 1969), with
+// coefficients in ascending powers:
+//   |x| <= 0.46875    erf(x)  = x N(x^2) / D(x^2)
+//   0.46875 < y <= 4  erfc(y) = exp(-y^2) N(y) / D(y)
+//   y > 4             erfc(y) = exp(-y^2) / y (1/sqrt(pi) + z N(z) / D(z)), z = 1/y^2
+template<concepts::FloatingPoint T>
+struct Cody {
+    static constexpr T small = T{0.46875};
+    static constexpr T large = T{4};
+
+    static constexpr Rational<T, 5, 5> small_fit{
+        {{
+            T{3.20937758913846947e03}, T{3.77485237685302021e02}, T{1.13864154151050156e02},
+            T{3.16112374387056560e00}, T{1.85777706184603153e-1}
+        }},
+        {{
+            T{2.84423683343917062e03}, T{1.28261652607737228e03}, T{2.44024637934444173e02},
+            T{2.36012909523441209e01}, T{1}
+        }}
+    };
+    static constexpr Rational<T, 9, 9> mid_fit{
+        {{
+            T{1.23033935479799725e03}, T{2.05107837782607147e03}, T{1.71204761263407058e03},
+            T{8.81952221241769090e02}, T{2.98635138197400131e02}, T{6.61191906371416295e01},
+            T{8.88314979438837594e00}, T{5.64188496988670089e-1}, T{2.15311535474403846e-8}
+        }},
+        {{
+            T{1.23033935480374942e03}, T{3.43936767414372164e03}, T{4.36261909014324716e03},
+            T{3.29079923573345963e03}, T{1.62138957456669019e03}, T{5.37181101862009858e02},
+            T{1.17693950891312499e02}, T{1.57449261107098347e01}, T{1}
+        }}
+    };
+    static constexpr Rational<T, 6, 6> tail_fit{
+        {{
+            T{-6.58749161529837803e-4}, T{-1.60837851487422766e-2}, T{-1.25781726111229246e-1},
+            T{-3.60344899949804439e-1}, T{-3.05326634961232344e-1}, T{-1.63153871373020978e-2}
+        }},
+        {{
+            T{2.33520497626869185e-3}, T{6.05183413124413191e-2}, T{5.27905102951428412e-1},
+            T{1.87295284992346725e00}, T{2.56852019228982242e00}, T{1}
+        }}
+    };
+
+    static constexpr T erf_small(T x) {
+        T z = x * x;
+        return x * small_fit(z);
+    }
+
+    // erfc(y) * exp(y^2) on the middle and tail ranges.
+    static constexpr T scaled_mid(T y) {
+        return mid_fit(y);
+    }
+
+    static constexpr T scaled_tail(T y) {
+        T z = T{1} / (y * y);
+        T r = z * tail_fit(z);
+        return (std::numbers::inv_sqrtpi_v<T> + r) / y;
+    }
+};
+
+// exp(-c y^2) for y >= 0 and c a power of two, without the error of
+// rounding y^2: y = s + d with s the nearest multiple of 1/16, so c s^2 is
+// exact and exp(-c y^2) = exp(-c s^2) exp(-c d (y + s)). The rounding goes
+// through the 1.5 * 2^mant shifter (std::trunc does not vectorize), and y
+// is clamped where the result has long underflowed so infinities cannot
+// reach it.
+template<concepts::FloatingPoint T, typename Exp>
+inline T exp_neg_square(T y, Exp exp, T c = T{1}) {
+    constexpr T shifter = T{1.5} * simd::detail::pow2<T>(std::numeric_limits<T>::digits - 1);
+    T yc = simd::select(y > T{64}, T{64}, y);
+    T s = ((yc * T{16} + shifter) - shifter) / T{16};
+    return exp(-c * s * s) * exp(-c * (yc - s) * (yc + s));
+}
+
+// erfc(y) for y > Cody::small.
+template<concepts::FloatingPoint T>
+T erfc_precise_positive(T y) {
+    using C = Cody<T>;
+    T scaled = y <= C::large ? C::scaled_mid(y) : C::scaled_tail(y);
+    return scaled * exp_neg_square(y, [](T v) { return std::exp(v); });
+}
+
+// Branch-free form for the batch kernels: both ranges are evaluated and
+// the right one selected. Returns erfc(|v|) for |v| > Cody::small.
+template<concepts::FloatingPoint T>
+inline T erfc_precise_positive_kernel(T y) {
+    using C = Cody<T>;
+    T scaled = simd::select(y <= C::large, C::scaled_mid(y), C::scaled_tail(y));
+    return scaled * exp_neg_square(y, [](T v) { return simd::exp(v); });
+}
+
 template<concepts::FloatingPoint T>
-T erf(T x) {
-    constexpr T a1 = T{0.254829592};
-    constexpr T a2 = T{-0.284496736};
-    constexpr T a3 = T{1.421413741};
-    constexpr T a4 = T{-1.453152027};
-    constexpr T a5 = T{1.061405429};
-    constexpr T p = T{0.3275911};
-    
-    int sign = (x < T{0}) ? -1 : 1;
-    x = std::abs(x);
-    
-    T t = T{1} / (T{1} + p * x);
-    T y = T{1} - (((((a5 * t + a4) * t) + a3) * t + a2) * t + a1) * t * std::exp(-x * x);
-    
-    return sign * y;
+inline T erf_precise_kernel(T v) {
+    using C = Cody<T>;
+    T y = std::abs(v);
+    T large = std::copysign(T{1} - erfc_precise_positive_kernel(y), v);
+    return simd::select(y <= C::small, C::erf_small(v), large);
+}
+
+template<concepts::FloatingPoint T>
+inline T erfc_precise_kernel(T v) {
+    using C = Cody<T>;
+    T y = std::abs(v);
+    T tail = erfc_precise_positive_kernel(y);
+    T large = simd::select(v < T{0}, T{2} - tail, tail);
+    return simd::select(y <= C::small, T{1} - C::erf_small(v), large);
+}
+
+// Phi(u) for the standard normal. Phi(-y) = erfc(y / sqrt2) / 2, but the
+// exponential is taken of y^2 / 2 directly: rounding y / sqrt2 first would
+// cost a relative error of about y^2 ulps in the tail.
+template<concepts::FloatingPoint T>
+T normal_cdf_precise(T u) {
+    using C = Cody<T>;
+    T z = u / std::numbers::sqrt2_v<T>;
+    T az = std::abs(z);
+    if (!(az > C::small)) {
+        return T{0.5} + T{0.5} * C::erf_small(z);
+    }
+    T scaled = az <= C::large ? C::scaled_mid(az) : C::scaled_tail(az);
+    T tail = T{0.5} * scaled * exp_neg_square(std::abs(u), [](T v) { return std::exp(v); }, T{0.5});
+    return u < T{0} ? tail : T{1} - tail;
 }
 
 template<concepts::FloatingPoint T>
-T erfc(T x) {
-    return T{1} - erf(x);
+inline T normal_cdf_precise_kernel(T u) {
+    using C = Cody<T>;
+    T z = u / std::numbers::sqrt2_v<T>;
+    T az = std::abs(z);
+    T scaled = simd::select(az <= C::large, C::scaled_mid(az), C::scaled_tail(az));
+    T tail = T{0.5} * scaled * exp_neg_square(std::abs(u), [](T v) { return simd::exp(v); }, T{0.5});
+    T large = simd::select(u < T{0}, tail, T{1} - tail);
+    return simd::select(az <= C::small, T{0.5} + T{0.5} * C::erf_small(z), large);
 }
 
+// M. J. Wichura, "Algorithm AS 241: The percentage points of the normal
+// distribution" (PPND16), relative error about 1e-16. Coefficients in
+// ascending powers:
+//   |p - 1/2| <= 0.425   x = q N(r) / D(r),   q = p - 1/2, r = 0.180625 - q^2
+//   r <= 5               x = N(r - 1.6) / D(r - 1.6),  r = sqrt(-log(min(p, 1 - p)))
+//   r > 5                x = N(r - 5) / D(r - 5)
 template<concepts::FloatingPoint T>
-T erf_inv(T x) {
-    // Handle edge cases
-    if (x <= T{-1}) {
-        return x == T{-1} ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::quiet_NaN();
+struct Wichura {
+    static constexpr T split = T{0.425};
+
+    static constexpr Rational<T, 8, 8> central_fit{
+        {{
+            T{3.3871328727963666080e0}, T{1.3314166789178437745e+2}, T{1.9715909503065514427e+3},
+            T{1.3731693765509461125e+4}, T{4.5921953931549871457e+4}, T{6.7265770927008700853e+4},
+            T{3.3430575583588128105e+4}, T{2.5090809287301226727e+3}
+        }},
+        {{
+            T{1}, T{4.2313330701600911252e+1}, T{6.8718700749205790830e+2},
+            T{5.3941960214247511077e+3}, T{2.1213794301586595867e+4}, T{3.9307895800092710610e+4},
+            T{2.8729085735721942674e+4}, T{5.2264952788528545610e+3}
+        }}
+    };
+    static constexpr Rational<T, 8, 8> mid_fit{
+        {{
+            T{1.42343711074968357734e0}, T{4.63033784615654529590e0}, T{5.76949722146069140550e0},
+            T{3.64784832476320460504e0}, T{1.27045825245236838258e0}, T{2.41780725177450611770e-1},
+            T{2.27238449892691845833e-2}, T{7.74545014278341407640e-4}
+        }},
+        {{
+            T{1}, T{2.05319162663775882187e0}, T{1.67638483018380384940e0},
+            T{6.89767334985100004550e-1}, T{1.48103976427480074590e-1}, T{1.51986665636164571966e-2},
+            T{5.47593808499534494600e-4}, T{1.05075007164441684324e-9}
+        }}
+    };
+    static constexpr Rational<T, 8, 8> tail_fit{
+        {{
+            T{6.65790464350110377720e0}, T{5.46378491116411436990e0}, T{1.78482653991729133580e0},
+            T{2.96560571828504891230e-1}, T{2.65321895265761230930e-2}, T{1.24266094738807843860e-3},
+            T{2.71155556874348757815e-5}, T{2.01033439929228813265e-7}
+        }},
+        {{
+            T{1}, T{5.99832206555887937690e-1}, T{1.36929880922735805310e-1},
+            T{1.48753612908506148525e-2}, T{7.86869131145613259100e-4}, T{1.84631831751005468180e-5},
+            T{1.42151175831644588870e-7}, T{2.04426310338993978564e-15}
+        }}
+    };
+
+    static constexpr T central(T q) {
+        T r = T{0.180625} - q * q;
+        return q * central_fit(r);
+    }
+
+    // Magnitude of the quantile from r = sqrt(-log(min(p, 1 - p))).
+    static constexpr T mid(T r) {
+        r -= T{1.6};
+        return mid_fit(r);
+    }
+
+    static constexpr T tail(T r) {
+        r -= T{5};
+        return tail_fit(r);
+    }
+};
+
+// P. J. Acklam's approximation, relative error about 1.2e-9:
+//   |p - 1/2| <= 0.47575  x = q N(q^2) / D(q^2)
+//   otherwise             x = N(t) / D(t),  t = sqrt(-2 log(min(p, 1 - p)))
+template<concepts::FloatingPoint T>
+struct Acklam {
+    static constexpr T split = T{0.47575};
+
+    static constexpr Rational<T, 6, 6> central_fit{
+        {{
+            T{2.506628277459239e+00}, T{-3.066479806614716e+01}, T{1.383577518672690e+02},
+            T{-2.759285104469687e+02}, T{2.209460984245205e+02}, T{-3.969683028665376e+01}
+        }},
+        {{
+            T{1}, T{-1.328068155288572e+01}, T{6.680131188771972e+01},
+            T{-1.556989798598866e+02}, T{1.615858368580409e+02}, T{-5.447609879822406e+01}
+        }}
+    };
+    static constexpr Rational<T, 6, 5> tail_fit{
+        {{
+            T{2.938163982698783e+00}, T{4.374664141464968e+00}, T{-2.549732539343734e+00},
+            T{-2.400758277161838e+00}, T{-3.223964580411365e-01}, T{-7.784894002430293e-03}
+        }},
+        {{
+            T{1}, T{3.754408661907416e+00}, T{2.445134137142996e+00},
+            T{3.224671290700398e-01}, T{7.784695709041462e-03}
+        }}
+    };
+
+    static constexpr T central(T q) {
+        T r = q * q;
+        return q * central_fit(r);
     }
-    if (x >= T{1}) {
-        return x == T{1} ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::quiet_NaN();
+
+    // Quantile of the smaller of p and 1 - p (so negative).
+    static constexpr T tail(T t) {
+        return tail_fit(t);
+    }
+};
+
+// Standard normal quantile for 0 < p < 1.
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A>
+T normal_quantile_standard(T p) {
+    T q = p - T{0.5};
+    T m = std::min(p, T{1} - p);
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        if (std::abs(q) <= Acklam<T>::split) {
+            return Acklam<T>::central(q);
+        }
+        T x = Acklam<T>::tail(std::sqrt(T{-2} * std::log(m)));
+        return q < T{0} ? x : -x;
+    } else {
+        if (std::abs(q) <= Wichura<T>::split) {
+            return Wichura<T>::central(q);
+        }
+        T r = std::sqrt(-std::log(m));
+        T x = r <= T{5} ? Wichura<T>::mid(r) : Wichura<T>::tail(r);
+        return q < T{0} ? -x : x;
     }
-    
-    // Handle very small values directly to avoid precision issues
-    if (std::abs(x) < T{1e-10}) return x; // erf_inv(x) approx x for small x
-    
-    // Save the sign of x
-    int sign = (x < T{0}) ? -1 : 1;
-    x = std::abs(x);
-    
-    // Use a rational approximation for better accuracy
-    // This is from Winitzki's approximation
-    T a = T{0.147};
-    T log_1mx2 = std::log(T{1} - x * x);
-    T term1 = T{2} / (std::numbers::pi_v<T> * a) + log_1mx2 / T{2};
-    T term2 = log_1mx2 / a;
-    T result = std::sqrt(-term1 + std::sqrt(term1 * term1 - term2));
-    
-    // Apply the saved sign to the result
-    return sign * result;
 }
 
+// M. Giles, "Approximating the erfinv function" (GPU Computing Gems, 2011),
+// coefficients in ascending powers. With w = -log((1 - x)(1 + x)),
+// erfinv(x) = x P(w - c) on the central range and x P(sqrt(w) - c) beyond.
+// Single-precision fit, relative error about 4e-7:
+//   w < 5    central(w - 2.5)
+//   w >= 5   tail(sqrt(w) - 3)
 template<concepts::FloatingPoint T>
-T normal_cdf(T x, T mu = T{0}, T sigma = T{1}) {
-    return T{0.5} * (T{1} + erf((x - mu) / (sigma * std::sqrt(T{2}))));
+struct GilesSingle {
+    static constexpr Polynomial<T, 9> central{{
+        T{1.50140941}, T{0.246640727}, T{-0.00417768164},
+        T{-0.00125372503}, T{0.00021858087}, T{-4.39150654e-06},
+        T{-3.5233877e-06}, T{3.43273939e-07}, T{2.81022636e-08}
+    }};
+    static constexpr Polynomial<T, 9> tail{{
+        T{2.83297682}, T{1.00167406}, T{0.00943887047},
+        T{-0.0076224613}, T{0.00573950773}, T{-0.00367342844},
+        T{0.00134934322}, T{0.000100950558}, T{-0.000200214257}
+    }};
+};
+
+// Double-precision fit, relative error about 2e-16 before rounding:
+//   w < 6.25   central(w - 3.125)
+//   w < 16     mid(sqrt(w) - 3.25)
+//   w >= 16    tail(sqrt(w) - 5)
+template<concepts::FloatingPoint T>
+struct GilesDouble {
+    static constexpr Polynomial<T, 23> central{{
+        T{1.6536545626831027356}, T{0.24015818242558961693}, T{-0.0060336708714301490533},
+        T{-0.00074070253416626697512}, T{0.0001867342080340571352}, T{-1.3882523362786468719e-05},
+        T{-1.3654692000834678645e-06}, T{4.2347877827932403518e-07}, T{-2.9070369957882005086e-08},
+        T{-4.1126339803469836976e-09}, T{1.051212273321532285e-09}, T{-5.4154120542946279317e-11},
+        T{-1.2975133253453532498e-11}, T{2.6335093153082322977e-12}, T{-8.1519341976054721522e-14},
+        T{-4.0545662729752068639e-14}, T{6.6376381343583238325e-15}, T{2.0972767875968561637e-17},
+        T{-1.333171662854620906e-16}, T{1.115787767802518096e-17}, T{1.2858480715256400167e-18},
+        T{-1.685059138182016589e-19}, T{-3.6444120640178196996e-21}
+    }};
+    static constexpr Polynomial<T, 19> mid{{
+        T{3.0838856104922207635}, T{1.0052589676941592334}, T{0.005370914553590063617},
+        T{-0.0037512085075692412107}, T{0.0024914420961078508066}, T{-0.0016882755560235047313},
+        T{0.00095328937973738049703}, T{-0.0003550375203628474796}, T{2.4031110387097893999e-05},
+        T{6.8284851459573175448e-05}, T{-4.7318229009055733981e-05}, T{1.2475304481671778723e-05},
+        T{2.9234449089955446044e-06}, T{-4.013867526981545969e-06}, T{1.5027403968909827627e-06},
+        T{1.8239629214389227755e-08}, T{-2.7517406297064545428e-07}, T{9.0756561938885390979e-08},
+        T{2.2137376921775787049e-09}
+    }};
+    static constexpr Polynomial<T, 17> tail{{
+        T{4.8499064014085844221}, T{1.0103004648645343977}, T{-0.00013871931833623122026},
+        T{-0.00021503011930044477347}, T{7.5995277030017761139e-05}, T{-1.9681778105531670567e-05},
+        T{4.5260625972231537039e-06}, T{-9.9298272942317002539e-07}, T{2.2900482228026654717e-07},
+        T{-6.7711997758452339498e-08}, T{2.9147953450901080826e-08}, T{-1.4960026627149240478e-08},
+        T{7.6157012080783393804e-09}, T{-3.7894654401267369937e-09}, T{1.5076572693500548083e-09},
+        T{-2.5556418169965252055e-10}, T{-2.7109920616438573243e-11}
+    }};
+};
+
+template<concepts::FloatingPoint T>
+T erf_inv_giles_single(T x, T w) {
+    using G = GilesSingle<T>;
+    T p = w < T{5} ? G::central(w - T{2.5}) : G::tail(std::sqrt(w) - T{3});
+    return p * x;
+}
+
+template<concepts::FloatingPoint T>
+T erf_inv_giles_double(T x, T w) {
+    using G = GilesDouble<T>;
+    T p;
+    if (w < T{6.25}) {
+        p = G::central(w - T{3.125});
+    } else if (w < T{16}) {
+        p = G::mid(std::sqrt(w) - T{3.25});
+    } else {
+        p = G::tail(std::sqrt(w) - T{5});
+    }
+    return p * x;
+}
+
+}
+
+// Error function. accuracy::fast is Abramowitz & Stegun 7.1.26 (about
+// 1.5e-7 absolute); accuracy::precise is Cody's rational approximation,
+// within a few ulps (about 1e-15 relative) for double.
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+T erf(T x, A = {}) {
+    T y = std::abs(x);
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        return std::copysign(detail::erf_positive(y, std::exp(-y * y)), x);
+    } else {
+        if (!(y > detail::Cody<T>::small)) {
+            return detail::Cody<T>::erf_small(x);
+        }
+        return std::copysign((T{0.5} - detail::erfc_precise_positive(y)) + T{0.5}, x);
+    }
+}
+
+// Complementary error function, computed directly rather than as
+// 1 - erf(x) so the upper tail keeps its relative accuracy.
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+T erfc(T x, A = {}) {
+    T y = std::abs(x);
+    T tail;
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        tail = detail::erfc_fast_positive(y, std::exp(-y * y));
+    } else {
+        if (!(y > detail::Cody<T>::small)) {
+            return T{1} - detail::Cody<T>::erf_small(x);
+        }
+        tail = detail::erfc_precise_positive(y);
+    }
+    return x < T{0} ? T{2} - tail : tail;
+}
+
+// Inverse error function on (-1, 1); +-inf at +-1 and NaN outside.
+// accuracy::fast is Giles' single-precision fit; accuracy::precise is his
+// double-precision fit followed by one Halley step on erf (erfc in the
+// tails, where erf(y) - x would cancel).
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+T erf_inv(T x, A = {}) {
+    if (!(std::abs(x) < T{1})) {
+        return std::abs(x) == T{1} ? std::copysign(std::numeric_limits<T>::infinity(), x)
+                                   : std::numeric_limits<T>::quiet_NaN();
+    }
+    T w = -std::log((T{1} - x) * (T{1} + x));
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        return detail::erf_inv_giles_single(x, w);
+    } else {
+        T y = detail::erf_inv_giles_double(x, w);
+        T ax = std::abs(x);
+        T f = ax <= T{0.5} ? erf(y) - x : std::copysign((T{1} - ax) - erfc(std::abs(y)), x);
+        T df = T{2} * std::numbers::inv_sqrtpi_v<T> * std::exp(-y * y);
+        return y - f / (df + y * f);
+    }
+}
+
+// Normal CDF. The precise tier keeps the relative accuracy of the lower
+// tail.
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+T normal_cdf(T x, T mu = T{0}, T sigma = T{1}, [[maybe_unused]] A policy = {}) {
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        return T{0.5} * (T{1} + erf((x - mu) / (sigma * std::numbers::sqrt2_v<T>), policy));
+    } else {
+        return detail::normal_cdf_precise((x - mu) / sigma);
+    }
 }
 
 template<concepts::FloatingPoint T>
@@ -71,6 +449,89 @@ T normal_pdf(T x, T mu = T{0}, T sigma = T{1}) {
     return std::exp(-T{0.5} * z * z) / (sigma * std::sqrt(T{2} * std::numbers::pi_v<T>));
 }
 
+// Inverse of normal_cdf: -inf at p = 0, +inf at p = 1, NaN outside [0, 1].
+// accuracy::precise is Wichura's AS 241 (about 1e-16 relative);
+// accuracy::fast is Acklam's approximation (about 1.2e-9).
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+T normal_quantile(T p, T mu = T{0}, T sigma = T{1}, A = {}) {
+    if (!(p > T{0} && p < T{1})) {
+        if (p == T{0}) return -std::numeric_limits<T>::infinity();
+        if (p == T{1}) return std::numeric_limits<T>::infinity();
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    return mu + sigma * detail::normal_quantile_standard<T, A>(p);
+}
+
+// Batch forms: out[i] = f(x[i]) over min(x.size(), out.size()) elements.
+// Both tiers are branch-free (range splits by select, sign by copysign,
+// exp by simd::exp) so the loop vectorizes; precise evaluates both of
+// Cody's outer ranges and costs about three times as much as fast.
+
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+void erf(std::span<const T> x, std::span<T> out, A = {}) {
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        simd::transform(x, out, [](T v) {
+            T a = std::abs(v);
+            return std::copysign(detail::erf_positive(a, simd::exp(-a * a)), v);
+        });
+    } else {
+        simd::transform(x, out, [](T v) { return detail::erf_precise_kernel(v); });
+    }
+}
+
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+void erfc(std::span<const T> x, std::span<T> out, A = {}) {
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        simd::transform(x, out, [](T v) {
+            T a = std::abs(v);
+            T tail = detail::erfc_fast_positive(a, simd::exp(-a * a));
+            return simd::select(v < T{0}, T{2} - tail, tail);
+        });
+    } else {
+        simd::transform(x, out, [](T v) { return detail::erfc_precise_kernel(v); });
+    }
+}
+
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+void normal_cdf(std::span<const T> x, std::span<T> out, T mu = T{0}, T sigma = T{1}, A = {}) {
+    if constexpr (std::same_as<A, accuracy::fast_t>) {
+        T scale = T{1} / (sigma * std::numbers::sqrt2_v<T>);
+        simd::transform(x, out, [mu, scale](T v) {
+            T z = (v - mu) * scale;
+            T a = std::abs(z);
+            return T{0.5} * (T{1} + std::copysign(detail::erf_positive(a, simd::exp(-a * a)), z));
+        });
+    } else {
+        T inv_sigma = T{1} / sigma;
+        simd::transform(x, out, [mu, inv_sigma](T v) {
+            return detail::normal_cdf_precise_kernel((v - mu) * inv_sigma);
+        });
+    }
+}
+
+template<concepts::FloatingPoint T>
+void normal_pdf(std::span<const T> x, std::span<T> out, T mu = T{0}, T sigma = T{1}) {
+    T inv_sigma = T{1} / sigma;
+    T norm = T{1} / (sigma * std::sqrt(T{2} * std::numbers::pi_v<T>));
+    simd::transform(x, out, [mu, inv_sigma, norm](T v) {
+        T z = (v - mu) * inv_sigma;
+        return simd::exp(-T{0.5} * z * z) * norm;
+    });
+}
+
+// Turns uniforms into normal deviates. The central range, which holds 85%
+// (precise) or 95% (fast) of uniform inputs, is one rational in p and
+// vectorizes; the tails, and p outside (0, 1), are patched afterwards by
+// the scalar form. Evaluating the tails branch-free as well measured
+// slower than this split for uniform input.
+template<concepts::FloatingPoint T, accuracy::AccuracyPolicy A = accuracy::precise_t>
+void normal_quantile(std::span<const T> p, std::span<T> out, T mu = T{0}, T sigma = T{1}, A = {}) {
+    using C = std::conditional_t<std::same_as<A, accuracy::fast_t>, detail::Acklam<T>, detail::Wichura<T>>;
+    simd::transform(p, out, [mu, sigma](T v) { return mu + sigma * C::central(v - T{0.5}); },
+        [](T v) { return !(std::abs(v - T{0.5}) <= C::split); },
+        [mu, sigma](T v) { return normal_quantile(v, mu, sigma, A{}); });
+}
+
 }
 
 #endif
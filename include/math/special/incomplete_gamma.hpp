@@ -0,0 +1,449 @@
+#ifndef MATH_SPECIAL_INCOMPLETE_GAMMA_HPP
+#define MATH_SPECIAL_INCOMPLETE_GAMMA_HPP
+
+#include "../core/concepts/arithmetic.hpp"
+#include "../core/polynomial.hpp"
+#include "gamma.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <span>
+
+namespace math::special {
+
+namespace detail {
+
+// log(1 + x) - x without cancellation for small x.
+template<concepts::FloatingPoint T>
+T log1pmx(T x) {
+    if (std::abs(x) > T{0.5}) {
+        return std::log1p(x) - x;
+    }
+    T power = x;
+    T sum = T{0};
+    for (int k = 2; k < 200; ++k) {
+        power *= -x;
+        T term = power / static_cast<T>(k);
+        sum += term;
+        if (std::abs(term) <= std::numeric_limits<T>::epsilon() * std::abs(sum)) {
+            break;
+        }
+    }
+    return sum;
+}
+
+// x^a e^-x / Gamma(a) for one fixed a. For a >= 1 the Lanczos form is
+// folded in so the large exponents cancel analytically:
+//   x^a e^-x / Gamma(a) = exp(a log1pmx(d) - (g - 1/2) d) sqrt(t / 2pi) / A_g(a - 1)
+// with t = a + g - 1/2 and d = (x - t) / t, accurate even when a ~ x ~ 1e6.
+template<concepts::FloatingPoint T>
+class GammaPrefix {
+    using L = Lanczos<T>;
+
+    T a_;
+    T t_;
+    T scale_;
+    T log_gamma_a_;
+    bool lanczos_;
+
+public:
+    explicit GammaPrefix(T a) : a_(a), t_(a + L::g - T{0.5}), scale_(T{0}), log_gamma_a_(T{0}), lanczos_(a >= T{1}) {
+        if (lanczos_) {
+            scale_ = std::sqrt(t_ / (T{2} * std::numbers::pi_v<T>)) / L::series(a - T{1});
+        } else {
+            log_gamma_a_ = log_gamma(a);
+        }
+    }
+
+    T operator()(T x) const {
+        if (lanczos_) {
+            T d = (x - t_) / t_;
+            // d rounds to -1 once x << t; take the log of x / t directly there.
+            T l = d < T{-0.5} ? std::log(x / t_) - d : log1pmx(d);
+            return std::exp(a_ * l - (L::g - T{0.5}) * d) * scale_;
+        }
+        return std::exp(a_ * std::log(x) - x - log_gamma_a_);
+    }
+};
+
+// P(a, x) by its power series; converges quickly for x < a + 1.
+template<concepts::FloatingPoint T>
+T gamma_p_series(T a, T x, T prefix) {
+    T ap = a;
+    T del = T{1} / a;
+    T sum = del;
+    for (int n = 0; n < 100000; ++n) {
+        ap += T{1};
+        del *= x / ap;
+        sum += del;
+        if (std::abs(del) < std::abs(sum) * std::numeric_limits<T>::epsilon()) {
+            break;
+        }
+    }
+    return sum * prefix;
+}
+
+// Q(a, x) by its continued fraction (modified Lentz); for x >= a + 1.
+template<concepts::FloatingPoint T>
+T gamma_q_fraction(T a, T x, T prefix) {
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+    constexpr T tiny = std::numeric_limits<T>::min() / eps;
+
+    T b = x + T{1} - a;
+    T c = T{1} / tiny;
+    T d = T{1} / b;
+    T h = d;
+    for (int i = 1; i < 100000; ++i) {
+        T an = -static_cast<T>(i) * (static_cast<T>(i) - a);
+        b += T{2};
+        d = an * d + b;
+        if (std::abs(d) < tiny) d = tiny;
+        c = b + an / c;
+        if (std::abs(c) < tiny) c = tiny;
+        d = T{1} / d;
+        T del = d * c;
+        h *= del;
+        if (std::abs(del - T{1}) <= eps) {
+            break;
+        }
+    }
+    return h * prefix;
+}
+
+// Coefficients of Temme's uniform expansion
+//   Q(a, x) = erfc(eta sqrt(a/2)) / 2 + e^(-a eta^2 / 2) / sqrt(2 pi a) sum_k C_k(eta) a^-k
+// as power series C_k(eta) = sum_n d[k][n] eta^n, generated at compile time:
+// mu = lambda - 1 is found from eta^2 / 2 = mu - log(1 + mu) by series
+// reversion, then C_0 = 1/mu - 1/eta and
+//   C_k = C_{k-1}'(eta) / eta + (-1)^k gamma_k / mu,
+// with gamma_k the Stirling coefficients of Gamma*(a).
+struct TemmeTable {
+    static constexpr int terms = 10;
+    static constexpr int order = 40;
+    static constexpr int n = order + 2 * terms + 2;
+
+    long double d[terms][order] = {};
+
+    constexpr TemmeTable() {
+        // u(mu) = 2 (mu - log(1 + mu)) / mu^2, g = sqrt(u), eta = mu g(mu).
+        long double u[n + 1] = {};
+        long double g[n + 1] = {};
+        for (int i = 0; i <= n; ++i) {
+            u[i] = (i % 2 == 0 ? 2.0L : -2.0L) / static_cast<long double>(i + 2);
+        }
+        g[0] = 1.0L;
+        for (int i = 1; i <= n; ++i) {
+            long double s = u[i];
+            for (int j = 1; j < i; ++j) {
+                s -= g[j] * g[i - j];
+            }
+            g[i] = s / 2.0L;
+        }
+
+        // Reversion: m[i] = [eta^i] mu, p[j][i] = [eta^i] mu^j.
+        long double m[n + 1] = {};
+        long double p[n + 1][n + 1] = {};
+        m[1] = 1.0L;
+        p[1][1] = 1.0L;
+        for (int i = 2; i <= n; ++i) {
+            long double s = 0.0L;
+            for (int j = 2; j <= i; ++j) {
+                long double pj = 0.0L;
+                for (int k = 1; k <= i - j + 1; ++k) {
+                    pj += m[k] * p[j - 1][i - k];
+                }
+                p[j][i] = pj;
+                s += g[j - 1] * pj;
+            }
+            m[i] = -s;
+            p[1][i] = m[i];
+        }
+
+        // r = eta / mu.
+        long double r[n] = {};
+        r[0] = 1.0L;
+        for (int i = 1; i < n; ++i) {
+            long double s = 0.0L;
+            for (int k = 1; k <= i; ++k) {
+                s -= m[k + 1] * r[i - k];
+            }
+            r[i] = s;
+        }
+
+        // gamma_k from log Gamma*(a) = sum B_2j / (2j (2j - 1) a^(2j-1)).
+        constexpr long double bernoulli[] = {1.0L / 6, -1.0L / 30, 1.0L / 42, -1.0L / 30, 5.0L / 66, -691.0L / 2730};
+        long double l[terms + 1] = {};
+        for (int j = 1; 2 * j - 1 <= terms; ++j) {
+            l[2 * j - 1] = bernoulli[j - 1] / static_cast<long double>(2 * j * (2 * j - 1));
+        }
+        long double stirling[terms + 1] = {};
+        stirling[0] = 1.0L;
+        for (int i = 1; i <= terms; ++i) {
+            long double s = 0.0L;
+            for (int k = 1; k <= i; ++k) {
+                s += static_cast<long double>(k) * l[k] * stirling[i - k];
+            }
+            stirling[i] = s / static_cast<long double>(i);
+        }
+
+        long double c[n] = {};
+        long double next[n] = {};
+        for (int i = 0; i + 1 < n; ++i) {
+            c[i] = r[i + 1];
+        }
+        for (int k = 0; k < terms; ++k) {
+            if (k > 0) {
+                long double sign = k % 2 == 0 ? 1.0L : -1.0L;
+                for (int i = 0; i + 2 < n; ++i) {
+                    next[i] = static_cast<long double>(i + 2) * c[i + 2] + sign * stirling[k] * r[i + 1];
+                }
+                for (int i = 0; i < n; ++i) {
+                    c[i] = i + 2 < n ? next[i] : 0.0L;
+                }
+            }
+            for (int i = 0; i < order; ++i) {
+                d[k][i] = c[i];
+            }
+        }
+    }
+};
+
+inline constexpr TemmeTable temme_table{};
+
+// C_k(eta) narrowed to T, one polynomial per term.
+template<concepts::FloatingPoint T>
+inline constexpr auto temme_polynomials = [] {
+    std::array<Polynomial<T, TemmeTable::order>, TemmeTable::terms> c{};
+    for (int k = 0; k < TemmeTable::terms; ++k) {
+        c[k] = Polynomial<T, TemmeTable::order>::from(temme_table.d[k]);
+    }
+    return c;
+}();
+
+// Temme's expansion; returns Q, or P when lower is set. Used for large a
+// with x near a, where both the series and the fraction need O(sqrt(a))
+// terms.
+template<concepts::FloatingPoint T>
+T gamma_temme(T a, T x, bool lower) {
+    T mu = (x - a) / a;
+    T half_eta2 = -log1pmx(mu);
+    T eta = std::copysign(std::sqrt(T{2} * half_eta2), mu);
+
+    T sum = T{0};
+    T inv_a = T{1} / a;
+    for (int k = TemmeTable::terms - 1; k >= 0; --k) {
+        sum = sum * inv_a + temme_polynomials<T>[k](eta);
+    }
+    T r = std::exp(-a * half_eta2) / std::sqrt(T{2} * std::numbers::pi_v<T> * a) * sum;
+    T s = eta * std::sqrt(a / T{2});
+    return lower ? T{0.5} * std::erfc(-s) - r : T{0.5} * std::erfc(s) + r;
+}
+
+template<concepts::FloatingPoint T>
+bool use_temme(T a, T x) {
+    return a > T{20} && std::abs(x - a) < T{0.3} * a;
+}
+
+// Regularized P (lower) or Q given a prefix evaluator for a.
+template<concepts::FloatingPoint T>
+T incomplete_gamma(T a, T x, bool lower, const GammaPrefix<T>& prefix) {
+    if (x == T{0}) {
+        return lower ? T{0} : T{1};
+    }
+    if (x == std::numeric_limits<T>::infinity()) {
+        return lower ? T{1} : T{0};
+    }
+    if (use_temme(a, x)) {
+        return gamma_temme(a, x, lower);
+    }
+    if (x < a + T{1}) {
+        T p = gamma_p_series(a, x, prefix(x));
+        return lower ? p : T{1} - p;
+    }
+    T q = gamma_q_fraction(a, x, prefix(x));
+    return lower ? T{1} - q : q;
+}
+
+// Solves P(a, x) = p (lower) or Q(a, x) = q from the Numerical Recipes
+// (invgammp) starting point. target is p or q. Near the centre the
+// iteration is Halley on F - target; in the tails, where F spans many
+// decades between the guess and the root, it is Newton on log F - log target.
+template<concepts::FloatingPoint T>
+T incomplete_gamma_inv(T a, T target, bool lower, const GammaPrefix<T>& prefix) {
+    T p = lower ? target : T{1} - target;
+    T q = lower ? T{1} - target : target;
+    T a1 = a - T{1};
+    T x;
+
+    if (a > T{1}) {
+        T pp = std::min(p, q);
+        T t = std::sqrt(T{-2} * std::log(pp));
+        T z = (T{2.30753} + t * T{0.27061}) / (T{1} + t * (T{0.99229} + t * T{0.04481})) - t;
+        if (p < T{0.5}) z = -z;
+        T c = T{1} - T{1} / (T{9} * a) - z / (T{3} * std::sqrt(a));
+        x = a * c * c * c;
+        // P(a, x) <= x^a / Gamma(a + 1), with equality as x -> 0: the
+        // bound is the better start deep in the lower tail.
+        T x0 = std::exp((std::log(p) + log_gamma(a + T{1})) / a);
+        if (!(x > T{0}) || (p < T{0.5} && x0 < T{0.1} * (a + T{1}))) {
+            x = x0;
+        }
+    } else {
+        T t = T{1} - a * (T{0.253} + a * T{0.12});
+        x = p < t ? std::pow(p / t, T{1} / a) : T{1} - std::log(q / (T{1} - t));
+    }
+
+    const T tol = std::sqrt(std::numeric_limits<T>::epsilon());
+    const bool tail = target < T{0.1};
+    for (int j = 0; j < 50; ++j) {
+        if (!(x > T{0})) {
+            return T{0};
+        }
+        T f = incomplete_gamma(a, x, lower, prefix);
+        T density = prefix(x) / x;
+        if (!(f > T{0}) || !(density > T{0})) {
+            // Underflow: the last step overshot past the root.
+            x = lower ? T{2} * x : T{0.5} * x;
+            continue;
+        }
+        T slope = lower ? density : -density;
+        T step;
+        if (tail) {
+            step = std::log(f / target) * f / slope;
+        } else {
+            T u = (f - target) / slope;
+            step = u / (T{1} - T{0.5} * std::min(T{1}, u * (a1 / x - T{1})));
+        }
+        x -= step;
+        if (x <= T{0}) x = T{0.5} * (x + step);
+        if (std::abs(step) < tol * x) {
+            break;
+        }
+    }
+    return x;
+}
+
+}
+
+// Regularized lower incomplete gamma P(a, x) = gamma(a, x) / Gamma(a): the
+// CDF of Gamma(a, 1), and through it of chi-square and Poisson.
+template<concepts::FloatingPoint T>
+T gamma_p(T a, T x) {
+    if (!(a > T{0}) || !(x >= T{0})) {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    return detail::incomplete_gamma(a, x, true, detail::GammaPrefix<T>(a));
+}
+
+// Regularized upper incomplete gamma Q(a, x) = 1 - P(a, x), computed
+// directly so small tails keep their relative accuracy.
+template<concepts::FloatingPoint T>
+T gamma_q(T a, T x) {
+    if (!(a > T{0}) || !(x >= T{0})) {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    return detail::incomplete_gamma(a, x, false, detail::GammaPrefix<T>(a));
+}
+
+// x such that P(a, x) = p.
+template<concepts::FloatingPoint T>
+T gamma_p_inv(T a, T p) {
+    if (!(a > T{0}) || !(p >= T{0}) || p > T{1}) {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    if (p == T{0}) {
+        return T{0};
+    }
+    if (p == T{1}) {
+        return std::numeric_limits<T>::infinity();
+    }
+    return detail::incomplete_gamma_inv(a, p, true, detail::GammaPrefix<T>(a));
+}
+
+// x such that Q(a, x) = q.
+template<concepts::FloatingPoint T>
+T gamma_q_inv(T a, T q) {
+    if (!(a > T{0}) || !(q >= T{0}) || q > T{1}) {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    if (q == T{1}) {
+        return T{0};
+    }
+    if (q == T{0}) {
+        return std::numeric_limits<T>::infinity();
+    }
+    return detail::incomplete_gamma_inv(a, q, false, detail::GammaPrefix<T>(a));
+}
+
+// Batch forms for one shape a: out[i] = f(a, x[i]) over
+// min(x.size(), out.size()) elements. As with the other batch forms, the
+// spans come first and the parameter after. The Lanczos part of the
+// prefix is evaluated once.
+
+template<concepts::FloatingPoint T>
+void gamma_p(std::span<const T> x, std::span<T> out, T a) {
+    std::size_t n = std::min(x.size(), out.size());
+    if (!(a > T{0})) {
+        std::fill_n(out.begin(), n, std::numeric_limits<T>::quiet_NaN());
+        return;
+    }
+    detail::GammaPrefix<T> prefix(a);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = x[i] >= T{0} ? detail::incomplete_gamma(a, x[i], true, prefix) : std::numeric_limits<T>::quiet_NaN();
+    }
+}
+
+template<concepts::FloatingPoint T>
+void gamma_q(std::span<const T> x, std::span<T> out, T a) {
+    std::size_t n = std::min(x.size(), out.size());
+    if (!(a > T{0})) {
+        std::fill_n(out.begin(), n, std::numeric_limits<T>::quiet_NaN());
+        return;
+    }
+    detail::GammaPrefix<T> prefix(a);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = x[i] >= T{0} ? detail::incomplete_gamma(a, x[i], false, prefix) : std::numeric_limits<T>::quiet_NaN();
+    }
+}
+
+template<concepts::FloatingPoint T>
+void gamma_p_inv(std::span<const T> p, std::span<T> out, T a) {
+    std::size_t n = std::min(p.size(), out.size());
+    if (!(a > T{0})) {
+        std::fill_n(out.begin(), n, std::numeric_limits<T>::quiet_NaN());
+        return;
+    }
+    detail::GammaPrefix<T> prefix(a);
+    for (std::size_t i = 0; i < n; ++i) {
+        T v = p[i];
+        if (v > T{0} && v < T{1}) {
+            out[i] = detail::incomplete_gamma_inv(a, v, true, prefix);
+        } else {
+            out[i] = gamma_p_inv(a, v);
+        }
+    }
+}
+
+template<concepts::FloatingPoint T>
+void gamma_q_inv(std::span<const T> q, std::span<T> out, T a) {
+    std::size_t n = std::min(q.size(), out.size());
+    if (!(a > T{0})) {
+        std::fill_n(out.begin(), n, std::numeric_limits<T>::quiet_NaN());
+        return;
+    }
+    detail::GammaPrefix<T> prefix(a);
+    for (std::size_t i = 0; i < n; ++i) {
+        T v = q[i];
+        if (v > T{0} && v < T{1}) {
+            out[i] = detail::incomplete_gamma_inv(a, v, false, prefix);
+        } else {
+            out[i] = gamma_q_inv(a, v);
+        }
+    }
+}
+
+}
+
+#endif
@@ -2,49 +2,50 @@
 #define MATH_STATS_DESCRIPTIVE_CENTRAL_HPP
 
 #include "../../core/concepts/arithmetic.hpp"
+#include "../../core/summation.hpp"
 #include "../../core/vector.hpp"
+#include "../../exec/parallel.hpp"
+#include "../../exec/policy.hpp"
+#include "order.hpp"
 #include <vector>
 #include <algorithm>
 #include <cmath>
 
 namespace math::stats::descriptive {
 
-template<concepts::Arithmetic T>
-T mean(const std::vector<T>& data) {
+// The trailing summation policy picks the accumulator; pairwise keeps the
+// error at O(log n) ulps for the cost of a naive loop.
+template<concepts::Arithmetic T, summation::SummationPolicy S = summation::pairwise_t>
+T mean(const std::vector<T>& data, S policy = {}) {
     if (data.empty()) {
         return T{0};
     }
     
-    T sum = T{0};
-    for (const auto& x : data) {
-        sum += x;
-    }
+    T sum = summation::sum(std::span<const T>(data), policy);
     return sum / static_cast<T>(data.size());
 }
 
-template<concepts::Arithmetic T, std::size_t N>
-T mean(const Vector<T, N>& data) {
-    T sum = T{0};
-    for (std::size_t i = 0; i < N; ++i) {
-        sum += data[i];
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T>
+T mean(const Policy& policy, const std::vector<T>& data) {
+    if (data.empty()) {
+        return T{0};
     }
+    
+    T sum = exec::transform_sum<T>(policy, data.size(), [&data](std::size_t i) { return data[i]; });
+    return sum / static_cast<T>(data.size());
+}
+
+template<concepts::Arithmetic T, std::size_t N, summation::SummationPolicy S = summation::pairwise_t>
+T mean(const Vector<T, N>& data, S policy = {}) {
+    T sum = summation::sum(std::span<const T>(data.data(), N), policy);
     return sum / static_cast<T>(N);
 }
 
+// Selection rather than a sort: expected O(n). median_in_place and
+// quantile_in_place skip the copy when the caller's data may be reordered.
 template<concepts::Arithmetic T>
 T median(std::vector<T> data) {
-    if (data.empty()) {
-        return T{0};
-    }
-    
-    std::sort(data.begin(), data.end());
-    std::size_t n = data.size();
-    
-    if (n % 2 == 0) {
-        return (data[n/2 - 1] + data[n/2]) / T{2};
-    } else {
-        return data[n/2];
-    }
+    return median_in_place(std::span<T>(data));
 }
 
 template<concepts::Arithmetic T>
@@ -89,25 +90,7 @@ std::vector<T> mode(const std::vector<T>& data) {
 
 template<concepts::Arithmetic T>
 T quantile(std::vector<T> data, double q) {
-    if (data.empty() || q < 0.0 || q > 1.0) {
-        return T{0};
-    }
-    
-    std::sort(data.begin(), data.end());
-    
-    if (q == 0.0) return data.front();
-    if (q == 1.0) return data.back();
-    
-    double pos = q * (data.size() - 1);
-    std::size_t lower = static_cast<std::size_t>(std::floor(pos));
-    std::size_t upper = static_cast<std::size_t>(std::ceil(pos));
-    
-    if (lower == upper) {
-        return data[lower];
-    }
-    
-    double weight = pos - lower;
-    return data[lower] * (1.0 - weight) + data[upper] * weight;
+    return quantile_in_place(std::span<T>(data), q);
 }
 
 }
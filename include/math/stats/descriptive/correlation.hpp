@@ -5,25 +5,42 @@
 #include "../../core/vector.hpp"
 #include "central.hpp"
 #include "dispersion.hpp"
+#include "rank.hpp"
 #include <vector>
 #include <cmath>
 
 namespace math::stats::descriptive {
 
-template<concepts::Arithmetic T>
-T covariance(const std::vector<T>& x, const std::vector<T>& y, bool sample = true) {
+template<concepts::Arithmetic T, summation::SummationPolicy S = summation::pairwise_t>
+T covariance(const std::vector<T>& x, const std::vector<T>& y, bool sample = true, S policy = {}) {
     if (x.size() != y.size() || x.empty() || (sample && x.size() == 1)) {
         return T{0};
     }
     
-    T mean_x = mean(x);
-    T mean_y = mean(y);
+    T mean_x = mean(x, policy);
+    T mean_y = mean(y, policy);
+    
+    T sum = summation::transform_dot<T>(0, x.size(),
+        [&x, mean_x](std::size_t i) { return x[i] - mean_x; },
+        [&y, mean_y](std::size_t i) { return y[i] - mean_y; }, policy);
     
-    T sum = T{0};
-    for (std::size_t i = 0; i < x.size(); ++i) {
-        sum += (x[i] - mean_x) * (y[i] - mean_y);
+    std::size_t n = sample ? x.size() - 1 : x.size();
+    return sum / static_cast<T>(n);
+}
+
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T>
+T covariance(const Policy& policy, const std::vector<T>& x, const std::vector<T>& y, bool sample = true) {
+    if (x.size() != y.size() || x.empty() || (sample && x.size() == 1)) {
+        return T{0};
     }
     
+    T mean_x = mean(policy, x);
+    T mean_y = mean(policy, y);
+    
+    T sum = exec::transform_sum<T>(policy, x.size(), [&x, &y, mean_x, mean_y](std::size_t i) {
+        return (x[i] - mean_x) * (y[i] - mean_y);
+    });
+    
     std::size_t n = sample ? x.size() - 1 : x.size();
     return sum / static_cast<T>(n);
 }
@@ -45,40 +62,22 @@ T correlation(const std::vector<T>& x, const std::vector<T>& y) {
     return cov / (std_x * std_y);
 }
 
+// Spearman's rho with average ranks for ties; see rank.hpp.
 template<concepts::Arithmetic T>
-T spearman_correlation(std::vector<T> x, std::vector<T> y) {
+T spearman_correlation(const std::vector<T>& x, const std::vector<T>& y) {
     if (x.size() != y.size() || x.size() < 2) {
         return T{0};
     }
-    
-    std::vector<std::size_t> rank_x(x.size());
-    std::vector<std::size_t> rank_y(y.size());
-    
-    std::vector<std::size_t> indices_x(x.size());
-    std::vector<std::size_t> indices_y(y.size());
-    for (std::size_t i = 0; i < x.size(); ++i) {
-        indices_x[i] = i;
-        indices_y[i] = i;
-    }
-    
-    std::sort(indices_x.begin(), indices_x.end(),
-              [&x](std::size_t i, std::size_t j) { return x[i] < x[j]; });
-    std::sort(indices_y.begin(), indices_y.end(),
-              [&y](std::size_t i, std::size_t j) { return y[i] < y[j]; });
-    
-    for (std::size_t i = 0; i < x.size(); ++i) {
-        rank_x[indices_x[i]] = i + 1;
-        rank_y[indices_y[i]] = i + 1;
-    }
-    
-    std::vector<T> rank_x_t(x.size());
-    std::vector<T> rank_y_t(y.size());
-    for (std::size_t i = 0; i < x.size(); ++i) {
-        rank_x_t[i] = static_cast<T>(rank_x[i]);
-        rank_y_t[i] = static_cast<T>(rank_y[i]);
+    return static_cast<T>(spearman(std::span<const T>(x), std::span<const T>(y)));
+}
+
+// Kendall's tau-b in O(n log n); see rank.hpp.
+template<concepts::Arithmetic T>
+T kendall_correlation(const std::vector<T>& x, const std::vector<T>& y) {
+    if (x.size() != y.size() || x.size() < 2) {
+        return T{0};
     }
-    
-    return correlation(rank_x_t, rank_y_t);
+    return static_cast<T>(kendall_tau(std::span<const T>(x), std::span<const T>(y)));
 }
 
 }
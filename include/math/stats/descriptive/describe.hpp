@@ -0,0 +1,131 @@
+#ifndef MATH_STATS_DESCRIPTIVE_DESCRIBE_HPP
+#define MATH_STATS_DESCRIPTIVE_DESCRIBE_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../exec/parallel.hpp"
+#include "../../exec/policy.hpp"
+#include "running.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace math::stats::descriptive {
+
+// Everything describe() reports. NaN inputs are counted in nan_count and
+// left out of every other field; count is the number of values used.
+// variance and std_dev are the sample forms, skewness and kurtosis the
+// population g1 and excess g2 of RunningStats. An input with no usable
+// values gives count 0, zero moments, NaN skewness and kurtosis, min +inf
+// and max -inf.
+template<concepts::FloatingPoint T>
+struct Summary {
+    std::size_t count = 0;
+    std::size_t nan_count = 0;
+    T sum = T{0};
+    T mean = T{0};
+    T variance = T{0};
+    T std_dev = T{0};
+    T min = std::numeric_limits<T>::infinity();
+    T max = -std::numeric_limits<T>::infinity();
+    T skewness = std::numeric_limits<T>::quiet_NaN();
+    T kurtosis = std::numeric_limits<T>::quiet_NaN();
+};
+
+namespace detail {
+
+// RunningStats plus a NaN tally. Each chunk is checked for NaNs in one
+// vectorized count; clean chunks (the usual case) go straight to
+// RunningStats::push, and only a chunk that has NaNs is compacted into a
+// stack buffer first. The chunk is still in L1 for every sweep, so the
+// data is read from memory once.
+template<concepts::FloatingPoint T>
+struct DescribeAccumulator {
+    static constexpr std::size_t chunk = 1024;
+
+    RunningStats<T> stats;
+    std::size_t nans = 0;
+
+    void push(std::span<const T> data) {
+        T kept[chunk];
+        for (std::size_t i = 0; i < data.size(); i += chunk) {
+            std::size_t m = std::min(chunk, data.size() - i);
+            const T* src = data.data() + i;
+            std::size_t bad = 0;
+            for (std::size_t j = 0; j < m; ++j) {
+                bad += src[j] != src[j] ? 1 : 0;
+            }
+            if (bad == 0) {
+                stats.push(std::span<const T>(src, m));
+                continue;
+            }
+            std::size_t k = 0;
+            for (std::size_t j = 0; j < m; ++j) {
+                if (!std::isnan(src[j])) {
+                    kept[k++] = src[j];
+                }
+            }
+            nans += bad;
+            stats.push(std::span<const T>(kept, k));
+        }
+    }
+
+    void merge(const DescribeAccumulator& other) {
+        stats.merge(other.stats);
+        nans += other.nans;
+    }
+
+    Summary<T> summary() const {
+        Summary<T> s;
+        s.count = stats.count();
+        s.nan_count = nans;
+        if (s.count == 0) {
+            return s;
+        }
+        s.sum = stats.sum();
+        s.mean = stats.mean();
+        s.variance = stats.variance();
+        s.std_dev = std::sqrt(s.variance);
+        s.min = stats.min();
+        s.max = stats.max();
+        s.skewness = stats.skewness();
+        s.kurtosis = stats.kurtosis();
+        return s;
+    }
+};
+
+}
+
+// Count, sum, mean, variance, standard deviation, min, max, skewness,
+// excess kurtosis and NaN count in a single sweep over data, instead of
+// one scan per statistic.
+template<concepts::FloatingPoint T>
+Summary<T> describe(std::span<const T> data) {
+    detail::DescribeAccumulator<T> acc;
+    acc.push(data);
+    return acc.summary();
+}
+
+// The same summary with chunks of data described in parallel and merged in
+// order.
+template<exec::ExecutionPolicy Policy, concepts::FloatingPoint T>
+Summary<T> describe(const Policy& policy, std::span<const T> data) {
+    using Acc = detail::DescribeAccumulator<T>;
+    constexpr std::size_t min_grain = std::size_t{1} << 16;
+    Acc acc = exec::parallel_reduce(policy, 0, data.size(), min_grain, Acc(),
+        [data](std::size_t begin, std::size_t end) {
+            Acc part;
+            part.push(data.subspan(begin, end - begin));
+            return part;
+        },
+        [](Acc a, const Acc& b) {
+            a.merge(b);
+            return a;
+        });
+    return acc.summary();
+}
+
+}
+
+#endif
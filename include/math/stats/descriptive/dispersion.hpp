@@ -10,50 +10,63 @@
 
 namespace math::stats::descriptive {
 
-template<concepts::Arithmetic T>
-T variance(const std::vector<T>& data, bool sample = true) {
+template<concepts::Arithmetic T, summation::SummationPolicy S = summation::pairwise_t>
+T variance(const std::vector<T>& data, bool sample = true, S policy = {}) {
     if (data.empty() || (sample && data.size() == 1)) {
         return T{0};
     }
     
-    T mu = mean(data);
-    T sum_sq = T{0};
+    T mu = mean(data, policy);
+    auto diff = [&data, mu](std::size_t i) { return data[i] - mu; };
+    T sum_sq = summation::transform_dot<T>(0, data.size(), diff, diff, policy);
     
-    for (const auto& x : data) {
-        T diff = x - mu;
-        sum_sq += diff * diff;
+    std::size_t n = sample ? data.size() - 1 : data.size();
+    return sum_sq / static_cast<T>(n);
+}
+
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T>
+T variance(const Policy& policy, const std::vector<T>& data, bool sample = true) {
+    if (data.empty() || (sample && data.size() == 1)) {
+        return T{0};
     }
     
+    T mu = mean(policy, data);
+    T sum_sq = exec::transform_sum<T>(policy, data.size(), [&data, mu](std::size_t i) {
+        T diff = data[i] - mu;
+        return diff * diff;
+    });
+    
     std::size_t n = sample ? data.size() - 1 : data.size();
     return sum_sq / static_cast<T>(n);
 }
 
-template<concepts::Arithmetic T, std::size_t N>
-T variance(const Vector<T, N>& data, bool sample = true) {
+template<concepts::Arithmetic T, std::size_t N, summation::SummationPolicy S = summation::pairwise_t>
+T variance(const Vector<T, N>& data, bool sample = true, S policy = {}) {
     if (sample && N == 1) {
         return T{0};
     }
     
-    T mu = mean(data);
-    T sum_sq = T{0};
-    
-    for (std::size_t i = 0; i < N; ++i) {
-        T diff = data[i] - mu;
-        sum_sq += diff * diff;
-    }
+    T mu = mean(data, policy);
+    auto diff = [&data, mu](std::size_t i) { return data[i] - mu; };
+    T sum_sq = summation::transform_dot<T>(0, N, diff, diff, policy);
     
     std::size_t n = sample ? N - 1 : N;
     return sum_sq / static_cast<T>(n);
 }
 
-template<concepts::Arithmetic T>
-T std_dev(const std::vector<T>& data, bool sample = true) {
-    return std::sqrt(variance(data, sample));
+template<concepts::Arithmetic T, summation::SummationPolicy S = summation::pairwise_t>
+T std_dev(const std::vector<T>& data, bool sample = true, S policy = {}) {
+    return std::sqrt(variance(data, sample, policy));
 }
 
-template<concepts::Arithmetic T, std::size_t N>
-T std_dev(const Vector<T, N>& data, bool sample = true) {
-    return std::sqrt(variance(data, sample));
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T>
+T std_dev(const Policy& policy, const std::vector<T>& data, bool sample = true) {
+    return std::sqrt(variance(policy, data, sample));
+}
+
+template<concepts::Arithmetic T, std::size_t N, summation::SummationPolicy S = summation::pairwise_t>
+T std_dev(const Vector<T, N>& data, bool sample = true, S policy = {}) {
+    return std::sqrt(variance(data, sample, policy));
 }
 
 template<concepts::Arithmetic T>
@@ -72,9 +85,10 @@ T iqr(std::vector<T> data) {
         return T{0};
     }
     
-    T q1 = quantile(data, 0.25);
-    T q3 = quantile(data, 0.75);
-    return q3 - q1;
+    const double qs[2] = {0.25, 0.75};
+    T q[2];
+    quantiles_in_place(std::span<T>(data), std::span<const double>(qs), std::span<T>(q));
+    return q[1] - q[0];
 }
 
 template<concepts::Arithmetic T>
@@ -84,14 +98,10 @@ T mad(const std::vector<T>& data) {
     }
     
     T mu = mean(data);
-    std::vector<T> deviations;
-    deviations.reserve(data.size());
-    
-    for (const auto& x : data) {
-        deviations.push_back(std::abs(x - mu));
-    }
-    
-    return mean(deviations);
+    T sum = summation::transform_sum<T>(0, data.size(), [&data, mu](std::size_t i) {
+        return std::abs(data[i] - mu);
+    }, summation::pairwise);
+    return sum / static_cast<T>(data.size());
 }
 
 }
@@ -0,0 +1,215 @@
+#ifndef MATH_STATS_DESCRIPTIVE_ORDER_HPP
+#define MATH_STATS_DESCRIPTIVE_ORDER_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace math::stats::descriptive {
+
+namespace detail {
+
+// Floyd and Rivest's SELECT (CACM 18(3), 1975; the form analysed by Kiwiel,
+// 2005). Above 600 elements it first recurses on a sample of about n^(2/3)
+// values around the expected position of k, which brackets the answer so
+// tightly that the partition that follows leaves only a small remainder:
+// about n + min(k, n - k) comparisons, against 2n to 3n for median-of-three
+// quickselect. Like introselect, it counts partitioning rounds and hands a
+// range that is not shrinking to std::nth_element, so bad inputs cannot
+// drive it quadratic.
+template<typename T>
+void floyd_rivest(T* a, std::ptrdiff_t left, std::ptrdiff_t right, std::ptrdiff_t k, int budget) {
+    while (right > left) {
+        if (--budget < 0) {
+            std::nth_element(a + left, a + k, a + right + 1);
+            return;
+        }
+        if (right - left > 600) {
+            double n = static_cast<double>(right - left + 1);
+            double i = static_cast<double>(k - left + 1);
+            double z = std::log(n);
+            double s = 0.5 * std::exp(2.0 * z / 3.0);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2.0 ? -1.0 : 1.0);
+            auto sub_left = std::max(left, static_cast<std::ptrdiff_t>(static_cast<double>(k) - i * s / n + sd));
+            auto sub_right = std::min(right, static_cast<std::ptrdiff_t>(static_cast<double>(k) + (n - i) * s / n + sd));
+            floyd_rivest(a, sub_left, sub_right, k, budget);
+        }
+        T t = a[k];
+        std::ptrdiff_t i = left;
+        std::ptrdiff_t j = right;
+        std::swap(a[left], a[k]);
+        if (t < a[right]) {
+            std::swap(a[right], a[left]);
+        }
+        while (i < j) {
+            std::swap(a[i], a[j]);
+            ++i;
+            --j;
+            while (a[i] < t) {
+                ++i;
+            }
+            while (t < a[j]) {
+                --j;
+            }
+        }
+        if (a[left] == t) {
+            std::swap(a[left], a[j]);
+        } else {
+            ++j;
+            std::swap(a[j], a[right]);
+        }
+        if (j <= k) {
+            left = j + 1;
+        }
+        if (k <= j) {
+            right = j - 1;
+        }
+    }
+}
+
+template<typename T>
+void select(T* a, std::size_t first, std::size_t last, std::size_t k) {
+    int budget = 2 * std::bit_width(last - first) + 8;
+    floyd_rivest(a, static_cast<std::ptrdiff_t>(first), static_cast<std::ptrdiff_t>(last) - 1,
+                 static_cast<std::ptrdiff_t>(k), budget);
+}
+
+// Places every rank in ranks (sorted, distinct, all in [first, last)) at
+// its sorted position: select the middle rank, then recurse on the ranks
+// either side within the two halves it leaves. q ranks cost O(n log q)
+// rather than q separate selections over the whole range.
+template<typename T>
+void multiselect(T* a, std::size_t first, std::size_t last, std::span<const std::size_t> ranks) {
+    while (!ranks.empty()) {
+        std::size_t mid = ranks.size() / 2;
+        std::size_t k = ranks[mid];
+        select(a, first, last, k);
+        multiselect(a, first, k, ranks.first(mid));
+        first = k + 1;
+        ranks = ranks.subspan(mid + 1);
+    }
+}
+
+// Linear interpolation between order statistics lower and lower + 1 at
+// pos = q (n - 1), the same definition quantile() has always used.
+template<typename T>
+T interpolate(T lo, T hi, double weight) {
+    if (weight == 0.0) {
+        return lo;
+    }
+    return lo * (1.0 - weight) + hi * weight;
+}
+
+inline bool valid_probability(double q) {
+    return q >= 0.0 && q <= 1.0;
+}
+
+}
+
+// The k-th smallest value (0-based) of data, found in expected O(n) time.
+// data is reordered so that data[k] holds it, nothing before k is greater
+// and nothing after it is smaller, as with std::nth_element. k must be
+// less than data.size().
+template<concepts::Arithmetic T>
+T select_nth(std::span<T> data, std::size_t k) {
+    detail::select(data.data(), 0, data.size(), k);
+    return data[k];
+}
+
+// quantile() without the copy: data is partially reordered. The upper
+// neighbour for interpolation is the minimum of the part above the lower
+// one, a scan rather than a second selection.
+template<concepts::Arithmetic T>
+T quantile_in_place(std::span<T> data, double q) {
+    if (data.empty() || !detail::valid_probability(q)) {
+        return T{0};
+    }
+    double pos = q * static_cast<double>(data.size() - 1);
+    std::size_t lower = static_cast<std::size_t>(std::floor(pos));
+    double weight = pos - static_cast<double>(lower);
+    T lo = select_nth(data, lower);
+    if (weight == 0.0) {
+        return lo;
+    }
+    T hi = *std::min_element(data.begin() + static_cast<std::ptrdiff_t>(lower) + 1, data.end());
+    return detail::interpolate(lo, hi, weight);
+}
+
+template<concepts::Arithmetic T>
+T median_in_place(std::span<T> data) {
+    if (data.empty()) {
+        return T{0};
+    }
+    std::size_t n = data.size();
+    T hi = select_nth(data, n / 2);
+    if (n % 2 == 1) {
+        return hi;
+    }
+    T lo = *std::max_element(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(n / 2));
+    return (lo + hi) / T{2};
+}
+
+// out[i] = quantile(data, qs[i]) for every i < min(qs.size(), out.size()),
+// with all the order statistics the probabilities need placed by one
+// multiselect. data is partially reordered. A probability outside [0, 1]
+// gives 0, as in quantile().
+template<concepts::Arithmetic T>
+void quantiles_in_place(std::span<T> data, std::span<const double> qs, std::span<T> out) {
+    std::size_t m = std::min(qs.size(), out.size());
+    if (data.empty()) {
+        std::fill_n(out.begin(), m, T{0});
+        return;
+    }
+    double last = static_cast<double>(data.size() - 1);
+    std::vector<std::size_t> ranks;
+    ranks.reserve(2 * m);
+    for (std::size_t i = 0; i < m; ++i) {
+        if (!detail::valid_probability(qs[i])) {
+            continue;
+        }
+        double pos = qs[i] * last;
+        std::size_t lower = static_cast<std::size_t>(std::floor(pos));
+        ranks.push_back(lower);
+        if (pos > static_cast<double>(lower)) {
+            ranks.push_back(lower + 1);
+        }
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    detail::multiselect(data.data(), 0, data.size(), std::span<const std::size_t>(ranks));
+
+    for (std::size_t i = 0; i < m; ++i) {
+        if (!detail::valid_probability(qs[i])) {
+            out[i] = T{0};
+            continue;
+        }
+        double pos = qs[i] * last;
+        std::size_t lower = static_cast<std::size_t>(std::floor(pos));
+        double weight = pos - static_cast<double>(lower);
+        out[i] = weight == 0.0 ? data[lower] : detail::interpolate(data[lower], data[lower + 1], weight);
+    }
+}
+
+// Several quantiles of one sample, e.g. quantiles(latencies, {0.5, 0.9,
+// 0.99}), for the cost of about one selection.
+template<concepts::Arithmetic T>
+std::vector<T> quantiles(std::vector<T> data, std::span<const double> qs) {
+    std::vector<T> out(qs.size());
+    quantiles_in_place(std::span<T>(data), qs, std::span<T>(out));
+    return out;
+}
+
+template<concepts::Arithmetic T>
+std::vector<T> quantiles(std::vector<T> data, std::initializer_list<double> qs) {
+    return quantiles(std::move(data), std::span<const double>(qs.begin(), qs.size()));
+}
+
+}
+
+#endif
@@ -0,0 +1,356 @@
+#ifndef MATH_STATS_DESCRIPTIVE_RANK_HPP
+#define MATH_STATS_DESCRIPTIVE_RANK_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../exec/parallel.hpp"
+#include "../../exec/policy.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace math::stats::descriptive {
+
+// How tied values share ranks (1-based): average gives each member of a tie
+// the mean of the positions it spans (what Spearman's rho needs), min the
+// lowest of them, dense the tie's index among distinct values.
+enum class Ties { average, min, dense };
+
+// Buffers reused across calls so repeated ranking of similar-sized inputs
+// does not allocate; contents are unspecified between calls.
+template<concepts::Arithmetic T>
+struct RankScratch {
+    std::vector<std::pair<T, std::size_t>> keyed;
+    std::vector<std::pair<T, std::size_t>> keyed_buffer;
+    std::vector<std::pair<T, T>> pairs;
+    std::vector<std::pair<T, T>> pairs_buffer;
+    std::vector<T> ys;
+    std::vector<T> ys_buffer;
+    std::vector<double> rank_x;
+    std::vector<double> rank_y;
+};
+
+namespace detail {
+
+// Merges sorted src[lo, mid) and src[mid, hi) into dst[lo, hi), stably,
+// returning how many (left, right) pairs were out of order: each time a
+// right element is taken first it jumps every left element still waiting.
+template<bool Count, typename E, typename Less>
+std::uint64_t merge_runs(const E* src, E* dst, std::size_t lo, std::size_t mid, std::size_t hi, Less less) {
+    std::uint64_t inversions = 0;
+    std::size_t i = lo;
+    std::size_t j = mid;
+    std::size_t k = lo;
+    while (i < mid && j < hi) {
+        if (less(src[j], src[i])) {
+            if constexpr (Count) {
+                inversions += mid - i;
+            }
+            dst[k++] = src[j++];
+        } else {
+            dst[k++] = src[i++];
+        }
+    }
+    std::copy(src + i, src + mid, dst + k);
+    std::copy(src + j, src + hi, dst + k + (mid - i));
+    return inversions;
+}
+
+// Insertion sort of a short run, counting the shifts (= inversions).
+template<typename E, typename Less>
+std::uint64_t insertion_sort(E* a, std::size_t n, Less less) {
+    std::uint64_t shifts = 0;
+    for (std::size_t i = 1; i < n; ++i) {
+        E v = a[i];
+        std::size_t j = i;
+        while (j > 0 && less(v, a[j - 1])) {
+            a[j] = a[j - 1];
+            --j;
+        }
+        shifts += i - j;
+        a[j] = v;
+    }
+    return shifts;
+}
+
+// Bottom-up merge sort: base runs are sorted independently (by std::sort,
+// or by a counting insertion sort of 32 elements when Count), then rounds
+// of pairwise merges ping-pong between data and buffer. Runs within a
+// round are independent, so both phases go through parallel_for. With
+// Count it returns the number of inversions of the input under less
+// (Knight's O(n log n) count for Kendall's tau).
+template<bool Count, exec::ExecutionPolicy P, typename E, typename Less>
+std::uint64_t merge_sort(const P& policy, std::span<E> data, std::vector<E>& buffer, Less less) {
+    std::size_t n = data.size();
+    if (n < 2) {
+        return 0;
+    }
+    std::size_t run = 32;
+    if constexpr (!Count) {
+        if constexpr (exec::ParallelPolicy<P>) {
+            run = exec::detail::resolve_grain(policy, n, std::size_t{1} << 14);
+        } else {
+            run = n;
+        }
+    }
+    std::size_t runs = (n + run - 1) / run;
+    std::vector<std::uint64_t> counts(runs, 0);
+    exec::parallel_for(policy, 0, runs, 1, [&](std::size_t r0, std::size_t r1) {
+        for (std::size_t r = r0; r < r1; ++r) {
+            std::size_t lo = r * run;
+            std::size_t m = std::min(run, n - lo);
+            if constexpr (Count) {
+                counts[r] = insertion_sort(data.data() + lo, m, less);
+            } else {
+                std::sort(data.data() + lo, data.data() + lo + m, less);
+            }
+        }
+    });
+    std::uint64_t total = 0;
+    for (std::uint64_t c : counts) {
+        total += c;
+    }
+    if (runs == 1) {
+        return total;
+    }
+
+    buffer.resize(n);
+    E* src = data.data();
+    E* dst = buffer.data();
+    for (std::size_t width = run; width < n; width *= 2) {
+        std::size_t pairs = (n + 2 * width - 1) / (2 * width);
+        std::vector<std::uint64_t> merged(pairs, 0);
+        std::size_t min_grain = std::max<std::size_t>(1, (std::size_t{1} << 15) / (2 * width));
+        exec::parallel_for(policy, 0, pairs, min_grain, [&](std::size_t p0, std::size_t p1) {
+            for (std::size_t p = p0; p < p1; ++p) {
+                std::size_t lo = p * 2 * width;
+                std::size_t mid = std::min(n, lo + width);
+                std::size_t hi = std::min(n, lo + 2 * width);
+                merged[p] = merge_runs<Count>(src, dst, lo, mid, hi, less);
+            }
+        });
+        for (std::uint64_t c : merged) {
+            total += c;
+        }
+        std::swap(src, dst);
+    }
+    if (src != data.data()) {
+        std::copy(src, src + n, data.data());
+    }
+    return total;
+}
+
+template<typename E>
+bool by_first(const E& a, const E& b) { return a.first < b.first; }
+
+// Ranks from (value, original index) pairs sorted by value.
+template<concepts::Arithmetic T>
+void assign_ranks(std::span<const std::pair<T, std::size_t>> sorted, std::span<double> out, Ties ties) {
+    std::size_t n = sorted.size();
+    double distinct = 0.0;
+    for (std::size_t i = 0; i < n; ) {
+        std::size_t j = i + 1;
+        while (j < n && !(sorted[i].first < sorted[j].first)) {
+            ++j;
+        }
+        distinct += 1.0;
+        double r = ties == Ties::average ? 0.5 * static_cast<double>(i + j + 1)
+                 : ties == Ties::min ? static_cast<double>(i + 1)
+                 : distinct;
+        for (std::size_t k = i; k < j; ++k) {
+            out[sorted[k].second] = r;
+        }
+        i = j;
+    }
+}
+
+template<concepts::Arithmetic T, typename Sort>
+void rank_with(std::span<const T> data, std::span<double> out, Ties ties, RankScratch<T>& scratch, Sort sort) {
+    std::size_t n = std::min(data.size(), out.size());
+    auto& keyed = scratch.keyed;
+    keyed.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keyed[i] = {data[i], i};
+    }
+    sort(std::span<std::pair<T, std::size_t>>(keyed));
+    assign_ranks(std::span<const std::pair<T, std::size_t>>(keyed), out.first(n), ties);
+}
+
+// Pearson correlation of two average-rank vectors. Both have mean
+// (n + 1) / 2 exactly, so a single pass suffices. 0 when either side is
+// constant, like correlation().
+inline double rank_correlation(std::span<const double> rx, std::span<const double> ry) {
+    std::size_t n = rx.size();
+    double centre = 0.5 * static_cast<double>(n + 1);
+    double sxy = 0.0;
+    double sxx = 0.0;
+    double syy = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        double dx = rx[i] - centre;
+        double dy = ry[i] - centre;
+        sxy += dx * dy;
+        sxx += dx * dx;
+        syy += dy * dy;
+    }
+    if (sxx == 0.0 || syy == 0.0) {
+        return 0.0;
+    }
+    return sxy / std::sqrt(sxx * syy);
+}
+
+// Number of pairs within runs of equal values of a sorted range.
+template<typename E, typename Equal>
+std::uint64_t tied_pairs(std::span<const E> sorted, Equal equal) {
+    std::uint64_t pairs = 0;
+    std::uint64_t run = 1;
+    for (std::size_t i = 1; i < sorted.size(); ++i) {
+        if (equal(sorted[i - 1], sorted[i])) {
+            ++run;
+        } else {
+            pairs += run * (run - 1) / 2;
+            run = 1;
+        }
+    }
+    return pairs + run * (run - 1) / 2;
+}
+
+// Knight's algorithm (1966) for tau-b: sort the pairs by (x, y), count
+// the x ties and joint ties from runs, then merge sort the y column,
+// whose inversions are exactly the discordant pairs, and count the y
+// ties from the result. O(n log n) against the O(n^2) pair loop.
+template<exec::ExecutionPolicy P, concepts::Arithmetic T>
+double kendall_tau(const P& policy, std::span<const T> x, std::span<const T> y, RankScratch<T>& scratch) {
+    std::size_t n = std::min(x.size(), y.size());
+    if (n < 2) {
+        return 0.0;
+    }
+    auto& pairs = scratch.pairs;
+    pairs.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        pairs[i] = {x[i], y[i]};
+    }
+    merge_sort<false>(policy, std::span<std::pair<T, T>>(pairs), scratch.pairs_buffer,
+                      [](const std::pair<T, T>& a, const std::pair<T, T>& b) {
+                          return a.first < b.first || (!(b.first < a.first) && a.second < b.second);
+                      });
+    std::span<const std::pair<T, T>> sorted(pairs);
+    std::uint64_t x_ties = tied_pairs(sorted, [](const auto& a, const auto& b) { return !(a.first < b.first); });
+    std::uint64_t joint_ties = tied_pairs(sorted, [](const auto& a, const auto& b) {
+        return !(a.first < b.first) && !(a.second < b.second);
+    });
+
+    auto& ys = scratch.ys;
+    ys.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        ys[i] = pairs[i].second;
+    }
+    std::uint64_t discordant = merge_sort<true>(policy, std::span<T>(ys), scratch.ys_buffer,
+                                                [](T a, T b) { return a < b; });
+    std::uint64_t y_ties = tied_pairs(std::span<const T>(ys), [](T a, T b) { return !(a < b); });
+
+    std::uint64_t total = static_cast<std::uint64_t>(n) * (n - 1) / 2;
+    double concordant_minus_discordant = static_cast<double>(total) - static_cast<double>(x_ties)
+                                       - static_cast<double>(y_ties) + static_cast<double>(joint_ties)
+                                       - 2.0 * static_cast<double>(discordant);
+    double nx = static_cast<double>(total - x_ties);
+    double ny = static_cast<double>(total - y_ties);
+    if (nx == 0.0 || ny == 0.0) {
+        return 0.0;
+    }
+    return concordant_minus_discordant / std::sqrt(nx * ny);
+}
+
+}
+
+// out[i] = rank of data[i] among data (1-based, ties resolved by ties),
+// for i < min(data.size(), out.size()). One sort of (value, index) pairs
+// held in scratch. Values must be NaN-free.
+template<concepts::Arithmetic T>
+void rank(std::span<const T> data, std::span<double> out, Ties ties, RankScratch<T>& scratch) {
+    detail::rank_with(data, out, ties, scratch, [](std::span<std::pair<T, std::size_t>> keyed) {
+        std::sort(keyed.begin(), keyed.end(), detail::by_first<std::pair<T, std::size_t>>);
+    });
+}
+
+template<concepts::Arithmetic T>
+void rank(std::span<const T> data, std::span<double> out, Ties ties = Ties::average) {
+    RankScratch<T> scratch;
+    rank(data, out, ties, scratch);
+}
+
+// The same ranks with the sort split across the policy's workers: sorted
+// runs merged pairwise, each merge round in parallel.
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T>
+void rank(const Policy& policy, std::span<const T> data, std::span<double> out, Ties ties, RankScratch<T>& scratch) {
+    detail::rank_with(data, out, ties, scratch, [&](std::span<std::pair<T, std::size_t>> keyed) {
+        detail::merge_sort<false>(policy, keyed, scratch.keyed_buffer, detail::by_first<std::pair<T, std::size_t>>);
+    });
+}
+
+template<concepts::Arithmetic T>
+std::vector<double> ranks(std::span<const T> data, Ties ties = Ties::average) {
+    std::vector<double> out(data.size());
+    rank(data, std::span<double>(out), ties);
+    return out;
+}
+
+// Spearman's rho: Pearson's r of the average ranks, which handles ties
+// correctly. Pairs beyond the shorter input are ignored; 0 for fewer than
+// two pairs or a constant input.
+template<concepts::Arithmetic T>
+double spearman(std::span<const T> x, std::span<const T> y, RankScratch<T>& scratch) {
+    std::size_t n = std::min(x.size(), y.size());
+    if (n < 2) {
+        return 0.0;
+    }
+    scratch.rank_x.resize(n);
+    scratch.rank_y.resize(n);
+    rank(x.first(n), std::span<double>(scratch.rank_x), Ties::average, scratch);
+    rank(y.first(n), std::span<double>(scratch.rank_y), Ties::average, scratch);
+    return detail::rank_correlation(scratch.rank_x, scratch.rank_y);
+}
+
+template<concepts::Arithmetic T>
+double spearman(std::span<const T> x, std::span<const T> y) {
+    RankScratch<T> scratch;
+    return spearman(x, y, scratch);
+}
+
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T>
+double spearman(const Policy& policy, std::span<const T> x, std::span<const T> y, RankScratch<T>& scratch) {
+    std::size_t n = std::min(x.size(), y.size());
+    if (n < 2) {
+        return 0.0;
+    }
+    scratch.rank_x.resize(n);
+    scratch.rank_y.resize(n);
+    rank(policy, x.first(n), std::span<double>(scratch.rank_x), Ties::average, scratch);
+    rank(policy, y.first(n), std::span<double>(scratch.rank_y), Ties::average, scratch);
+    return detail::rank_correlation(scratch.rank_x, scratch.rank_y);
+}
+
+// Kendall's tau-b, (concordant - discordant) / sqrt((n0 - n1)(n0 - n2))
+// with n1, n2 the pairs tied in x and in y, in O(n log n). 0 for fewer
+// than two pairs or a constant input.
+template<concepts::Arithmetic T>
+double kendall_tau(std::span<const T> x, std::span<const T> y, RankScratch<T>& scratch) {
+    return detail::kendall_tau(exec::seq, x, y, scratch);
+}
+
+template<concepts::Arithmetic T>
+double kendall_tau(std::span<const T> x, std::span<const T> y) {
+    RankScratch<T> scratch;
+    return kendall_tau(x, y, scratch);
+}
+
+template<exec::ExecutionPolicy Policy, concepts::Arithmetic T>
+double kendall_tau(const Policy& policy, std::span<const T> x, std::span<const T> y, RankScratch<T>& scratch) {
+    return detail::kendall_tau(policy, x, y, scratch);
+}
+
+}
+
+#endif
@@ -0,0 +1,419 @@
+#ifndef MATH_STATS_DESCRIPTIVE_RUNNING_HPP
+#define MATH_STATS_DESCRIPTIVE_RUNNING_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../core/simd.hpp"
+#include "../../exec/parallel.hpp"
+#include "../../exec/policy.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace math::stats::descriptive {
+
+// Streaming moments: count, mean, the central sums M2, M3, M4, min and max.
+// push() is Welford's update extended to the third and fourth moments
+// (Terriberry); merge() combines two accumulators in O(1) with the
+// pairwise formulas of Chan, Golub and LeVeque and Pébay (2008), so
+// per-thread or per-shard accumulators fold into the same result as one
+// pass over the concatenated data, up to rounding.
+//
+// push(span) summarizes the span in chunks: each chunk's mean and centred
+// power sums are formed with simd::lanes<T> independent accumulators (a
+// loop that vectorizes, on data still in cache for the second sweep) and
+// then merged in, which is cheaper and more accurate than one Welford
+// update per element. NaN inputs propagate into the moments and are
+// ignored by min and max.
+template<concepts::FloatingPoint T>
+class RunningStats {
+    std::size_t n_ = 0;
+    T mean_ = T{0};
+    T m2_ = T{0};
+    T m3_ = T{0};
+    T m4_ = T{0};
+    T min_ = std::numeric_limits<T>::infinity();
+    T max_ = -std::numeric_limits<T>::infinity();
+
+    static constexpr std::size_t chunk = 1024;
+
+    // Exact summary of data[0, n) for n <= chunk.
+    static RunningStats summarize(const T* data, std::size_t n) {
+        constexpr std::size_t W = simd::lanes<T>;
+        T sum[W] = {};
+        T lo[W];
+        T hi[W];
+        std::fill_n(lo, W, std::numeric_limits<T>::infinity());
+        std::fill_n(hi, W, -std::numeric_limits<T>::infinity());
+        std::size_t body = n - n % W;
+        for (std::size_t i = 0; i < body; i += W) {
+            for (std::size_t l = 0; l < W; ++l) {
+                sum[l] += data[i + l];
+            }
+        }
+        // GCC does not vectorize a NaN-respecting min / max reduction, and
+        // one in the loop above would stop the sum vectorizing too, so the
+        // extremes get their own sweep over the (cached) chunk.
+        for (std::size_t i = 0; i < body; i += W) {
+            for (std::size_t l = 0; l < W; ++l) {
+                lo[l] = std::min(lo[l], data[i + l]);
+                hi[l] = std::max(hi[l], data[i + l]);
+            }
+        }
+        for (std::size_t i = body; i < n; ++i) {
+            T v = data[i];
+            sum[i - body] += v;
+            lo[i - body] = std::min(lo[i - body], v);
+            hi[i - body] = std::max(hi[i - body], v);
+        }
+
+        RunningStats s;
+        s.n_ = n;
+        T total = T{0};
+        for (std::size_t l = 0; l < W; ++l) {
+            total += sum[l];
+            s.min_ = std::min(s.min_, lo[l]);
+            s.max_ = std::max(s.max_, hi[l]);
+        }
+        T mu = total / static_cast<T>(n);
+
+        T p1[W] = {};
+        T p2[W] = {};
+        T p3[W] = {};
+        T p4[W] = {};
+        for (std::size_t i = 0; i < body; i += W) {
+            for (std::size_t l = 0; l < W; ++l) {
+                T d = data[i + l] - mu;
+                T d2 = d * d;
+                p1[l] += d;
+                p2[l] += d2;
+                p3[l] += d2 * d;
+                p4[l] += d2 * d2;
+            }
+        }
+        for (std::size_t i = body; i < n; ++i) {
+            T d = data[i] - mu;
+            T d2 = d * d;
+            p1[i - body] += d;
+            p2[i - body] += d2;
+            p3[i - body] += d2 * d;
+            p4[i - body] += d2 * d2;
+        }
+        // The power sums are about mu, which is off from the true mean by
+        // its rounding error e = sum(d) / n; shifting the sums by e is the
+        // binomial expansion of sum((d - e)^k).
+        T s1 = T{0};
+        T s2 = T{0};
+        T s3 = T{0};
+        T s4 = T{0};
+        for (std::size_t l = 0; l < W; ++l) {
+            s1 += p1[l];
+            s2 += p2[l];
+            s3 += p3[l];
+            s4 += p4[l];
+        }
+        T nt = static_cast<T>(n);
+        T e = s1 / nt;
+        s.mean_ = mu + e;
+        s.m2_ = s2 - nt * e * e;
+        s.m3_ = s3 - T{3} * e * s2 + T{2} * nt * e * e * e;
+        s.m4_ = s4 - T{4} * e * s3 + T{6} * e * e * s2 - T{3} * nt * e * e * e * e;
+        return s;
+    }
+
+public:
+    using value_type = T;
+
+    RunningStats() = default;
+
+    explicit RunningStats(std::span<const T> data) {
+        push(data);
+    }
+
+    void push(T x) {
+        T n1 = static_cast<T>(n_);
+        ++n_;
+        T n = static_cast<T>(n_);
+        T delta = x - mean_;
+        T delta_n = delta / n;
+        T delta_n2 = delta_n * delta_n;
+        T term = delta * delta_n * n1;
+        mean_ += delta_n;
+        m4_ += term * delta_n2 * (n * n - T{3} * n + T{3}) + T{6} * delta_n2 * m2_ - T{4} * delta_n * m3_;
+        m3_ += term * delta_n * (n - T{2}) - T{3} * delta_n * m2_;
+        m2_ += term;
+        min_ = std::min(min_, x);
+        max_ = std::max(max_, x);
+    }
+
+    void push(std::span<const T> data) {
+        for (std::size_t i = 0; i < data.size(); i += chunk) {
+            merge(summarize(data.data() + i, std::min(chunk, data.size() - i)));
+        }
+    }
+
+    void merge(const RunningStats& other) {
+        if (other.n_ == 0) {
+            return;
+        }
+        if (n_ == 0) {
+            *this = other;
+            return;
+        }
+        T na = static_cast<T>(n_);
+        T nb = static_cast<T>(other.n_);
+        T n = na + nb;
+        T delta = other.mean_ - mean_;
+        T delta_n = delta / n;
+        T delta_n2 = delta_n * delta_n;
+        T cross = delta * delta_n * na * nb;
+
+        T m4 = m4_ + other.m4_ + cross * delta_n2 * (na * na - na * nb + nb * nb)
+             + T{6} * delta_n2 * (na * na * other.m2_ + nb * nb * m2_)
+             + T{4} * delta_n * (na * other.m3_ - nb * m3_);
+        T m3 = m3_ + other.m3_ + cross * delta_n * (na - nb) + T{3} * delta_n * (na * other.m2_ - nb * m2_);
+        m2_ = m2_ + other.m2_ + cross;
+        m3_ = m3;
+        m4_ = m4;
+        mean_ += delta_n * nb;
+        n_ += other.n_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    void clear() { *this = RunningStats(); }
+
+    std::size_t count() const { return n_; }
+    T mean() const { return mean_; }
+    T sum() const { return mean_ * static_cast<T>(n_); }
+    T min() const { return min_; }
+    T max() const { return max_; }
+
+    // Central power sums sum((x - mean)^k), k = 2, 3, 4.
+    T m2() const { return m2_; }
+    T m3() const { return m3_; }
+    T m4() const { return m4_; }
+
+    // 0 for fewer than two values (one for the population form), like
+    // descriptive::variance.
+    T variance(bool sample = true) const {
+        if (n_ == 0 || (sample && n_ == 1)) {
+            return T{0};
+        }
+        return m2_ / static_cast<T>(sample ? n_ - 1 : n_);
+    }
+
+    T std_dev(bool sample = true) const {
+        return std::sqrt(variance(sample));
+    }
+
+    // Population (biased) skewness g1 = sqrt(n) M3 / M2^(3/2); NaN when
+    // every value is equal.
+    T skewness() const {
+        return std::sqrt(static_cast<T>(n_)) * m3_ / (m2_ * std::sqrt(m2_));
+    }
+
+    // Population excess kurtosis g2 = n M4 / M2^2 - 3.
+    T kurtosis() const {
+        return static_cast<T>(n_) * m4_ / (m2_ * m2_) - T{3};
+    }
+};
+
+// Streaming co-moment of paired values: the two means and M2s and the
+// cross sum C = sum((x - mean_x)(y - mean_y)), with the same O(1) merge.
+template<concepts::FloatingPoint T>
+class RunningCovariance {
+    std::size_t n_ = 0;
+    T mean_x_ = T{0};
+    T mean_y_ = T{0};
+    T m2_x_ = T{0};
+    T m2_y_ = T{0};
+    T c_ = T{0};
+
+    static constexpr std::size_t chunk = 1024;
+
+    static RunningCovariance summarize(const T* x, const T* y, std::size_t n) {
+        constexpr std::size_t W = simd::lanes<T>;
+        T sx[W] = {};
+        T sy[W] = {};
+        std::size_t body = n - n % W;
+        for (std::size_t i = 0; i < body; i += W) {
+            for (std::size_t l = 0; l < W; ++l) {
+                sx[l] += x[i + l];
+                sy[l] += y[i + l];
+            }
+        }
+        for (std::size_t i = body; i < n; ++i) {
+            sx[i - body] += x[i];
+            sy[i - body] += y[i];
+        }
+        T tx = T{0};
+        T ty = T{0};
+        for (std::size_t l = 0; l < W; ++l) {
+            tx += sx[l];
+            ty += sy[l];
+        }
+        T nt = static_cast<T>(n);
+        T mx = tx / nt;
+        T my = ty / nt;
+
+        T pxx[W] = {};
+        T pyy[W] = {};
+        T pxy[W] = {};
+        T ex[W] = {};
+        T ey[W] = {};
+        for (std::size_t i = 0; i < body; i += W) {
+            for (std::size_t l = 0; l < W; ++l) {
+                T dx = x[i + l] - mx;
+                T dy = y[i + l] - my;
+                ex[l] += dx;
+                ey[l] += dy;
+                pxx[l] += dx * dx;
+                pyy[l] += dy * dy;
+                pxy[l] += dx * dy;
+            }
+        }
+        for (std::size_t i = body; i < n; ++i) {
+            T dx = x[i] - mx;
+            T dy = y[i] - my;
+            ex[i - body] += dx;
+            ey[i - body] += dy;
+            pxx[i - body] += dx * dx;
+            pyy[i - body] += dy * dy;
+            pxy[i - body] += dx * dy;
+        }
+        T sum_ex = T{0};
+        T sum_ey = T{0};
+        RunningCovariance s;
+        for (std::size_t l = 0; l < W; ++l) {
+            sum_ex += ex[l];
+            sum_ey += ey[l];
+            s.m2_x_ += pxx[l];
+            s.m2_y_ += pyy[l];
+            s.c_ += pxy[l];
+        }
+        // Same first-order correction for the rounding of the means as in
+        // RunningStats.
+        T e_x = sum_ex / nt;
+        T e_y = sum_ey / nt;
+        s.n_ = n;
+        s.mean_x_ = mx + e_x;
+        s.mean_y_ = my + e_y;
+        s.m2_x_ -= nt * e_x * e_x;
+        s.m2_y_ -= nt * e_y * e_y;
+        s.c_ -= nt * e_x * e_y;
+        return s;
+    }
+
+public:
+    using value_type = T;
+
+    RunningCovariance() = default;
+
+    RunningCovariance(std::span<const T> x, std::span<const T> y) {
+        push(x, y);
+    }
+
+    void push(T x, T y) {
+        ++n_;
+        T n = static_cast<T>(n_);
+        T dx = x - mean_x_;
+        T dy = y - mean_y_;
+        mean_x_ += dx / n;
+        mean_y_ += dy / n;
+        m2_x_ += dx * (x - mean_x_);
+        m2_y_ += dy * (y - mean_y_);
+        c_ += dx * (y - mean_y_);
+    }
+
+    // Pairs (x[i], y[i]) over min(x.size(), y.size()) elements.
+    void push(std::span<const T> x, std::span<const T> y) {
+        std::size_t n = std::min(x.size(), y.size());
+        for (std::size_t i = 0; i < n; i += chunk) {
+            merge(summarize(x.data() + i, y.data() + i, std::min(chunk, n - i)));
+        }
+    }
+
+    void merge(const RunningCovariance& other) {
+        if (other.n_ == 0) {
+            return;
+        }
+        if (n_ == 0) {
+            *this = other;
+            return;
+        }
+        T na = static_cast<T>(n_);
+        T nb = static_cast<T>(other.n_);
+        T n = na + nb;
+        T dx = other.mean_x_ - mean_x_;
+        T dy = other.mean_y_ - mean_y_;
+        T w = na * nb / n;
+        m2_x_ += other.m2_x_ + dx * dx * w;
+        m2_y_ += other.m2_y_ + dy * dy * w;
+        c_ += other.c_ + dx * dy * w;
+        mean_x_ += dx * nb / n;
+        mean_y_ += dy * nb / n;
+        n_ += other.n_;
+    }
+
+    void clear() { *this = RunningCovariance(); }
+
+    std::size_t count() const { return n_; }
+    T mean_x() const { return mean_x_; }
+    T mean_y() const { return mean_y_; }
+
+    T variance_x(bool sample = true) const { return moment(m2_x_, sample); }
+    T variance_y(bool sample = true) const { return moment(m2_y_, sample); }
+    T covariance(bool sample = true) const { return moment(c_, sample); }
+
+    // Pearson's r; 0 when either variable is constant, like
+    // descriptive::correlation.
+    T correlation() const {
+        if (n_ < 2 || m2_x_ == T{0} || m2_y_ == T{0}) {
+            return T{0};
+        }
+        return c_ / std::sqrt(m2_x_ * m2_y_);
+    }
+
+private:
+    T moment(T sum, bool sample) const {
+        if (n_ == 0 || (sample && n_ == 1)) {
+            return T{0};
+        }
+        return sum / static_cast<T>(sample ? n_ - 1 : n_);
+    }
+};
+
+// RunningStats of data, with chunks of the span summarized in parallel and
+// merged in order.
+template<exec::ExecutionPolicy Policy, concepts::FloatingPoint T>
+RunningStats<T> running_stats(const Policy& policy, std::span<const T> data) {
+    constexpr std::size_t min_grain = std::size_t{1} << 16;
+    return exec::parallel_reduce(policy, 0, data.size(), min_grain, RunningStats<T>(),
+        [data](std::size_t begin, std::size_t end) {
+            return RunningStats<T>(data.subspan(begin, end - begin));
+        },
+        [](RunningStats<T> a, const RunningStats<T>& b) {
+            a.merge(b);
+            return a;
+        });
+}
+
+template<exec::ExecutionPolicy Policy, concepts::FloatingPoint T>
+RunningCovariance<T> running_covariance(const Policy& policy, std::span<const T> x, std::span<const T> y) {
+    constexpr std::size_t min_grain = std::size_t{1} << 16;
+    std::size_t n = std::min(x.size(), y.size());
+    return exec::parallel_reduce(policy, 0, n, min_grain, RunningCovariance<T>(),
+        [x, y](std::size_t begin, std::size_t end) {
+            return RunningCovariance<T>(x.subspan(begin, end - begin), y.subspan(begin, end - begin));
+        },
+        [](RunningCovariance<T> a, const RunningCovariance<T>& b) {
+            a.merge(b);
+            return a;
+        });
+}
+
+}
+
+#endif
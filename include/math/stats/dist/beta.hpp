@@ -0,0 +1,127 @@
+#ifndef MATH_STATS_DIST_BETA_HPP
+#define MATH_STATS_DIST_BETA_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../core/simd.hpp"
+#include "../../special/beta.hpp"
+#include <cmath>
+#include <limits>
+#include <span>
+
+namespace math::stats::dist {
+
+// Beta(a, b) on [0, 1]. log B(a, b) is computed once and shared by every
+// density, incomplete-beta and inverse evaluation.
+template<concepts::FloatingPoint T>
+class Beta {
+    T a_;
+    T b_;
+    T log_beta_;
+
+public:
+    using value_type = T;
+
+    explicit Beta(T a = T{1}, T b = T{1}) : a_(a), b_(b) {
+        if (!(a > T{0}) || !(b > T{0}) || !std::isfinite(a) || !std::isfinite(b)) {
+            a_ = b_ = std::numeric_limits<T>::quiet_NaN();
+        }
+        log_beta_ = special::log_beta(a_, b_);
+    }
+
+    T a() const { return a_; }
+    T b() const { return b_; }
+    T mean() const { return a_ / (a_ + b_); }
+
+    T variance() const {
+        T s = a_ + b_;
+        return a_ * b_ / (s * s * (s + T{1}));
+    }
+
+    T pdf(T x) const {
+        if (x > T{0} && x < T{1}) {
+            return std::exp(logpdf(x));
+        }
+        if (std::isnan(x) || std::isnan(a_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        // At an endpoint the density is 0, infinite, or 1 / B(1, b) = b.
+        T e = x == T{0} ? a_ : (x == T{1} ? b_ : T{2});
+        T other = x == T{0} ? b_ : a_;
+        if (e > T{1}) {
+            return T{0};
+        }
+        return e == T{1} ? other : std::numeric_limits<T>::infinity();
+    }
+
+    T logpdf(T x) const {
+        if (!(x > T{0} && x < T{1})) {
+            return std::log(pdf(x));
+        }
+        return (a_ - T{1}) * std::log(x) + (b_ - T{1}) * std::log1p(-x) - log_beta_;
+    }
+
+    T cdf(T x) const {
+        if (std::isnan(x) || std::isnan(a_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (x <= T{0}) {
+            return T{0};
+        }
+        if (x >= T{1}) {
+            return T{1};
+        }
+        return special::detail::regularized_incomplete_beta(x, a_, b_, log_beta_);
+    }
+
+    // I_(1-x)(b, a); 1 - x is exact where the upper tail is small.
+    T sf(T x) const {
+        if (std::isnan(x) || std::isnan(a_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (x <= T{0}) {
+            return T{1};
+        }
+        if (x >= T{1}) {
+            return T{0};
+        }
+        return special::detail::regularized_incomplete_beta(T{1} - x, b_, a_, log_beta_);
+    }
+
+    T quantile(T p) const {
+        if (!(p > T{0} && p < T{1}) || std::isnan(a_)) {
+            return special::regularized_incomplete_beta_inv(p, a_, b_);
+        }
+        return special::detail::regularized_incomplete_beta_inv(p, a_, b_, log_beta_);
+    }
+
+    // Lanes outside (0, 1) are patched by the scalar forms.
+    void pdf(std::span<const T> x, std::span<T> out) const {
+        T am1 = a_ - T{1}, bm1 = b_ - T{1}, lb = log_beta_;
+        simd::transform(x, out, [am1, bm1, lb](T v) {
+            return simd::exp(am1 * simd::log(v) + bm1 * simd::log(T{1} - v) - lb);
+        }, [](T v) { return !(v > T{0} && v < T{1}); }, [this](T v) { return pdf(v); });
+    }
+
+    void logpdf(std::span<const T> x, std::span<T> out) const {
+        T am1 = a_ - T{1}, bm1 = b_ - T{1}, lb = log_beta_;
+        simd::transform(x, out, [am1, bm1, lb](T v) {
+            return am1 * simd::log(v) + bm1 * simd::log(T{1} - v) - lb;
+        }, [](T v) { return !(v > T{0} && v < T{1}); }, [this](T v) { return logpdf(v); });
+    }
+
+    void cdf(std::span<const T> x, std::span<T> out) const {
+        simd::transform(x, out, [this](T v) { return cdf(v); });
+    }
+
+    void sf(std::span<const T> x, std::span<T> out) const {
+        simd::transform(x, out, [this](T v) { return sf(v); });
+    }
+
+    void quantile(std::span<const T> p, std::span<T> out) const {
+        simd::transform(p, out, [this](T v) { return quantile(v); });
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,349 @@
+#ifndef MATH_STATS_DIST_DISCRETE_HPP
+#define MATH_STATS_DIST_DISCRETE_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../core/polynomial.hpp"
+#include "../../core/simd.hpp"
+#include "../../special/beta.hpp"
+#include "../../special/gamma.hpp"
+#include "../../special/incomplete_gamma.hpp"
+#include "normal.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+namespace math::stats::dist {
+
+namespace detail {
+
+// C. Loader, "Fast and Accurate Computation of Binomial Probabilities"
+// (2000). Probability masses are written through
+//   stirling_error(n) = log n! - ((n + 1/2) log n - n + log sqrt(2 pi))
+//   deviance(x, m)    = x log(x / m) + m - x
+// so the large logs cancel analytically and pmf keeps its relative accuracy
+// for large counts.
+
+// stirling_error(n) for n = 1..15, in long double at compile time.
+struct StirlingErrorTable {
+    static constexpr int size = 16;
+
+    long double value[size] = {};
+
+    constexpr StirlingErrorTable() {
+        constexpr long double half_log_two_pi = 0.918938533204672741780329736406L;
+        long double log_factorial = 0.0L;
+        for (int n = 1; n < size; ++n) {
+            long double ln = special::detail::constexpr_log(static_cast<long double>(n));
+            log_factorial += ln;
+            value[n] = log_factorial - ((static_cast<long double>(n) + 0.5L) * ln - static_cast<long double>(n) + half_log_two_pi);
+        }
+    }
+};
+
+inline constexpr StirlingErrorTable stirling_error_table{};
+
+// Integer n >= 1; beyond the table the Stirling series in 1/n^2.
+template<concepts::FloatingPoint T>
+T stirling_error(T n) {
+    static constexpr Polynomial<T, 5> series{{
+        T{1} / T{12}, T{-1} / T{360}, T{1} / T{1260}, T{-1} / T{1680}, T{1} / T{1188}
+    }};
+    if (n < static_cast<T>(StirlingErrorTable::size)) {
+        return static_cast<T>(stirling_error_table.value[static_cast<int>(n)]);
+    }
+    T r = T{1} / n;
+    return r * series(r * r);
+}
+
+// x log(x / m) + m - x; by the series in v = (x - m) / (x + m) when x is
+// near m, where the direct form cancels.
+template<concepts::FloatingPoint T>
+T deviance(T x, T m) {
+    if (std::abs(x - m) < T{0.1} * (x + m)) {
+        T v = (x - m) / (x + m);
+        T s = (x - m) * v;
+        T ej = T{2} * x * v;
+        v *= v;
+        for (int j = 1; j < 1000; ++j) {
+            ej *= v;
+            T s1 = s + ej / static_cast<T>(2 * j + 1);
+            if (s1 == s) {
+                return s1;
+            }
+            s = s1;
+        }
+        return s;
+    }
+    return x * std::log(x / m) + m - x;
+}
+
+template<concepts::FloatingPoint T>
+bool is_count(T k) {
+    return k >= T{0} && k == std::floor(k) && std::isfinite(k);
+}
+
+// Smallest integer k in [lo, hi] with cdf(k) >= p, searched outward from
+// guess. The test allows a relative error of 64 ulps in the smaller tail
+// probability, so a cdf that rounds just below an exact boundary does not
+// push the answer one count too far. Above the median it is made on
+// sf(k) <= 1 - p instead: 1 - p is exact there, while cdf(k) has lost the
+// digits that separate neighbouring counts far in the upper tail.
+template<concepts::FloatingPoint T, typename Cdf, typename Sf>
+T discrete_quantile(T p, T guess, T lo, T hi, Cdf cdf, Sf sf) {
+    constexpr T slack = T{64} * std::numeric_limits<T>::epsilon();
+    bool upper = p > T{0.5};
+    T target = upper ? (T{1} - p) * (T{1} + slack) : p * (T{1} - slack);
+    auto reached = [&](T k) { return upper ? sf(k) <= target : cdf(k) >= target; };
+    T k = std::clamp(std::floor(guess), lo, hi);
+    if (reached(k)) {
+        while (k > lo && reached(k - T{1})) {
+            k -= T{1};
+        }
+        return k;
+    }
+    while (k < hi && !reached(k)) {
+        k += T{1};
+    }
+    return k;
+}
+
+// Cornish-Fisher start: mean + sd (z + skew (z^2 - 1) / 6).
+template<concepts::FloatingPoint T>
+T cornish_fisher(T p, T mean, T sd, T skew) {
+    T z = special::normal_quantile(p);
+    return mean + sd * (z + skew * (z * z - T{1}) / T{6});
+}
+
+}
+
+// Discrete distributions take counts as T, so one span type serves data
+// and results; non-integer counts have zero mass, and cdf / sf floor
+// their argument. pmf and logpmf stand in for pdf and logpdf.
+
+// Poisson(lambda), lambda >= 0.
+template<concepts::FloatingPoint T>
+class Poisson {
+    T lambda_;
+
+public:
+    using value_type = T;
+
+    explicit Poisson(T lambda = T{1}) : lambda_(lambda) {
+        if (!(lambda >= T{0}) || !std::isfinite(lambda)) {
+            lambda_ = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    T lambda() const { return lambda_; }
+    T mean() const { return lambda_; }
+    T variance() const { return lambda_; }
+
+    T logpmf(T k) const {
+        if (std::isnan(k) || std::isnan(lambda_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (!detail::is_count(k)) {
+            return -std::numeric_limits<T>::infinity();
+        }
+        if (lambda_ == T{0}) {
+            return k == T{0} ? T{0} : -std::numeric_limits<T>::infinity();
+        }
+        if (k == T{0}) {
+            return -lambda_;
+        }
+        return -detail::stirling_error(k) - detail::deviance(k, lambda_) - detail::half_log_two_pi<T> - T{0.5} * std::log(k);
+    }
+
+    T pmf(T k) const {
+        return std::exp(logpmf(k));
+    }
+
+    T cdf(T k) const {
+        if (std::isnan(k) || std::isnan(lambda_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (k < T{0}) {
+            return T{0};
+        }
+        if (std::isinf(k) || lambda_ == T{0}) {
+            return T{1};
+        }
+        return special::gamma_q(std::floor(k) + T{1}, lambda_);
+    }
+
+    T sf(T k) const {
+        if (std::isnan(k) || std::isnan(lambda_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (k < T{0}) {
+            return T{1};
+        }
+        if (std::isinf(k) || lambda_ == T{0}) {
+            return T{0};
+        }
+        return special::gamma_p(std::floor(k) + T{1}, lambda_);
+    }
+
+    T quantile(T p) const {
+        if (!(p >= T{0} && p <= T{1}) || std::isnan(lambda_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (p == T{0} || lambda_ == T{0}) {
+            return T{0};
+        }
+        if (p == T{1}) {
+            return std::numeric_limits<T>::infinity();
+        }
+        T sd = std::sqrt(lambda_);
+        T guess = detail::cornish_fisher(p, lambda_, sd, T{1} / sd);
+        return detail::discrete_quantile(p, guess, T{0}, std::numeric_limits<T>::max(), [this](T k) { return cdf(k); }, [this](T k) { return sf(k); });
+    }
+
+    void pmf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return pmf(v); });
+    }
+
+    void logpmf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return logpmf(v); });
+    }
+
+    void cdf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return cdf(v); });
+    }
+
+    void sf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return sf(v); });
+    }
+
+    void quantile(std::span<const T> p, std::span<T> out) const {
+        simd::transform(p, out, [this](T v) { return quantile(v); });
+    }
+};
+
+// Binomial(n, p): successes in n independent trials of probability p.
+template<concepts::FloatingPoint T>
+class Binomial {
+    T n_;
+    T p_;
+    T q_;
+
+public:
+    using value_type = T;
+
+    Binomial(std::int64_t n, T p) : n_(static_cast<T>(n)), p_(p), q_(T{1} - p) {
+        if (n < 0 || !(p >= T{0} && p <= T{1})) {
+            n_ = p_ = q_ = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    T trials() const { return n_; }
+    T probability() const { return p_; }
+    T mean() const { return n_ * p_; }
+    T variance() const { return n_ * p_ * q_; }
+
+    T logpmf(T k) const {
+        constexpr T neg_inf = -std::numeric_limits<T>::infinity();
+        if (std::isnan(k) || std::isnan(n_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (!detail::is_count(k) || k > n_) {
+            return neg_inf;
+        }
+        if (p_ == T{0}) {
+            return k == T{0} ? T{0} : neg_inf;
+        }
+        if (q_ == T{0}) {
+            return k == n_ ? T{0} : neg_inf;
+        }
+        if (k == T{0}) {
+            if (n_ == T{0}) {
+                return T{0};
+            }
+            return p_ < T{0.1} ? -detail::deviance(n_, n_ * q_) - n_ * p_ : n_ * std::log(q_);
+        }
+        if (k == n_) {
+            return q_ < T{0.1} ? -detail::deviance(n_, n_ * p_) - n_ * q_ : n_ * std::log(p_);
+        }
+        T m = n_ - k;
+        T lc = detail::stirling_error(n_) - detail::stirling_error(k) - detail::stirling_error(m)
+             - detail::deviance(k, n_ * p_) - detail::deviance(m, n_ * q_);
+        T lf = T{2} * detail::half_log_two_pi<T> + std::log(k) + std::log1p(-k / n_);
+        return lc - T{0.5} * lf;
+    }
+
+    T pmf(T k) const {
+        return std::exp(logpmf(k));
+    }
+
+    // P(X <= k) = I_q(n - k, k + 1).
+    T cdf(T k) const {
+        if (std::isnan(k) || std::isnan(n_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (k < T{0}) {
+            return T{0};
+        }
+        if (k >= n_) {
+            return T{1};
+        }
+        T j = std::floor(k);
+        return special::regularized_incomplete_beta(q_, n_ - j, j + T{1});
+    }
+
+    // P(X > k) = I_p(k + 1, n - k).
+    T sf(T k) const {
+        if (std::isnan(k) || std::isnan(n_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (k < T{0}) {
+            return T{1};
+        }
+        if (k >= n_) {
+            return T{0};
+        }
+        T j = std::floor(k);
+        return special::regularized_incomplete_beta(p_, j + T{1}, n_ - j);
+    }
+
+    T quantile(T p) const {
+        if (!(p >= T{0} && p <= T{1}) || std::isnan(n_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (p == T{0} || p_ == T{0}) {
+            return T{0};
+        }
+        if (p == T{1} || q_ == T{0}) {
+            return n_;
+        }
+        T sd = std::sqrt(n_ * p_ * q_);
+        T guess = detail::cornish_fisher(p, n_ * p_, sd, (q_ - p_) / sd);
+        return detail::discrete_quantile(p, guess, T{0}, n_, [this](T k) { return cdf(k); }, [this](T k) { return sf(k); });
+    }
+
+    void pmf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return pmf(v); });
+    }
+
+    void logpmf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return logpmf(v); });
+    }
+
+    void cdf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return cdf(v); });
+    }
+
+    void sf(std::span<const T> k, std::span<T> out) const {
+        simd::transform(k, out, [this](T v) { return sf(v); });
+    }
+
+    void quantile(std::span<const T> p, std::span<T> out) const {
+        simd::transform(p, out, [this](T v) { return quantile(v); });
+    }
+};
+
+}
+
+#endif
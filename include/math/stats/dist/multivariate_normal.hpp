@@ -0,0 +1,205 @@
+#ifndef MATH_STATS_DIST_MULTIVARIATE_NORMAL_HPP
+#define MATH_STATS_DIST_MULTIVARIATE_NORMAL_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../core/matrix.hpp"
+#include "../../core/simd.hpp"
+#include "../../core/vector.hpp"
+#include "../../linalg/decomposition.hpp"
+#include "../../random/engine.hpp"
+#include "../../random/ziggurat.hpp"
+#include "normal.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace math::stats::dist {
+
+// Normal(mu, Sigma) in N dimensions. The covariance is factored once,
+// Sigma = L L^T, and every density and draw reuses L.
+//
+// Batch forms take samples as the rows of a row-major array: sample s is
+// x[s N .. s N + N). They work through blocks of `block` samples held
+// transposed, one contiguous row of `block` values per coordinate, so the
+// triangular products against L run as axpy sweeps over whole blocks:
+// a level-3 TRMM / TRSM against the block instead of one matrix-vector
+// product per sample.
+template<concepts::FloatingPoint T, std::size_t N>
+class MultivariateNormal {
+    Vector<T, N> mean_;
+    Matrix<T, N, N> L_;
+    Vector<T, N> inv_diag_;
+    T log_norm_;
+
+    // Transposed block of N x block values: about 32 KB, so it stays in L1
+    // while L streams past it.
+    static constexpr std::size_t block = std::clamp<std::size_t>(4096 / N, 8, 256);
+
+    // z_i <- (z_i - sum_(j<i) L(i, j) z_j) / L(i, i) for every column of a
+    // transposed block of m samples: L^-1 applied to all of them at once.
+    void solve_block(T* z, std::size_t m) const {
+        for (std::size_t i = 0; i < N; ++i) {
+            T* zi = z + i * block;
+            for (std::size_t j = 0; j < i; ++j) {
+                T lij = L_(i, j);
+                const T* zj = z + j * block;
+                for (std::size_t s = 0; s < m; ++s) {
+                    zi[s] -= lij * zj[s];
+                }
+            }
+            T inv = inv_diag_[i];
+            for (std::size_t s = 0; s < m; ++s) {
+                zi[s] *= inv;
+            }
+        }
+    }
+
+public:
+    using value_type = T;
+    static constexpr std::size_t dimension = N;
+
+    // A covariance that cholesky_decompose rejects makes every method
+    // return NaN.
+    MultivariateNormal(const Vector<T, N>& mean, const Matrix<T, N, N>& covariance) : mean_(mean) {
+        auto chol = linalg::cholesky_decompose(covariance);
+        L_ = chol.L;
+        log_norm_ = -static_cast<T>(N) * detail::half_log_two_pi<T>;
+        for (std::size_t i = 0; i < N; ++i) {
+            inv_diag_[i] = T{1} / L_(i, i);
+            log_norm_ -= std::log(L_(i, i));
+        }
+        if (!chol.positive_definite) {
+            log_norm_ = std::numeric_limits<T>::quiet_NaN();
+            L_ = Matrix<T, N, N>::zeros();
+            for (std::size_t i = 0; i < N; ++i) {
+                L_(i, i) = log_norm_;
+                inv_diag_[i] = log_norm_;
+            }
+        }
+    }
+
+    const Vector<T, N>& mean() const { return mean_; }
+
+    // Lower-triangular Cholesky factor of the covariance.
+    const Matrix<T, N, N>& cholesky() const { return L_; }
+
+    bool valid() const { return !std::isnan(log_norm_); }
+
+    // log |Sigma|.
+    T log_determinant() const {
+        return T{-2} * (log_norm_ + static_cast<T>(N) * detail::half_log_two_pi<T>);
+    }
+
+    // log_norm - |L^-1 (x - mu)|^2 / 2, with the forward substitution done
+    // in place.
+    T logpdf(const Vector<T, N>& x) const {
+        Vector<T, N> z;
+        T q = T{0};
+        for (std::size_t i = 0; i < N; ++i) {
+            T sum = x[i] - mean_[i];
+            for (std::size_t j = 0; j < i; ++j) {
+                sum -= L_(i, j) * z[j];
+            }
+            z[i] = sum * inv_diag_[i];
+            q += z[i] * z[i];
+        }
+        return log_norm_ - T{0.5} * q;
+    }
+
+    T pdf(const Vector<T, N>& x) const {
+        return std::exp(logpdf(x));
+    }
+
+    // out[s] for the first min(x.size() / N, out.size()) samples.
+    void logpdf(std::span<const T> x, std::span<T> out) const {
+        std::size_t count = std::min(x.size() / N, out.size());
+        T z[N * block];
+        T q[block];
+        for (std::size_t s0 = 0; s0 < count; s0 += block) {
+            std::size_t m = std::min(block, count - s0);
+            const T* xs = x.data() + s0 * N;
+            for (std::size_t s = 0; s < m; ++s) {
+                for (std::size_t i = 0; i < N; ++i) {
+                    z[i * block + s] = xs[s * N + i] - mean_[i];
+                }
+            }
+            solve_block(z, m);
+            std::fill_n(q, m, T{0});
+            for (std::size_t i = 0; i < N; ++i) {
+                const T* zi = z + i * block;
+                for (std::size_t s = 0; s < m; ++s) {
+                    q[s] += zi[s] * zi[s];
+                }
+            }
+            T* dst = out.data() + s0;
+            for (std::size_t s = 0; s < m; ++s) {
+                dst[s] = log_norm_ - T{0.5} * q[s];
+            }
+        }
+    }
+
+    void pdf(std::span<const T> x, std::span<T> out) const {
+        logpdf(x, out);
+        std::size_t count = std::min(x.size() / N, out.size());
+        simd::transform(std::span<const T>(out.data(), count), out, [](T v) { return simd::exp(v); });
+    }
+
+    // mu + L z with z standard normal.
+    template<random::BitGenerator G>
+    Vector<T, N> sample(G& g) const {
+        Vector<T, N> z;
+        for (std::size_t i = 0; i < N; ++i) {
+            z[i] = static_cast<T>(random::normal(g));
+        }
+        Vector<T, N> x = mean_;
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = 0; j <= i; ++j) {
+                x[i] += L_(i, j) * z[j];
+            }
+        }
+        return x;
+    }
+
+    // Fills out.size() / N samples, row-major. Each block draws its
+    // standard normals in one span fill, applies L with a blocked TRMM
+    // (coordinate i of the block is mu_i + sum_(j<=i) L(i, j) z_j, one
+    // vector sweep per entry of L), then writes the samples out as rows.
+    template<random::BitGenerator G>
+    void sample(G& g, std::span<T> out) const {
+        std::size_t count = out.size() / N;
+        T z[N * block];
+        T y[block];
+        for (std::size_t s0 = 0; s0 < count; s0 += block) {
+            std::size_t m = std::min(block, count - s0);
+            T* xs = out.data() + s0 * N;
+            for (std::size_t i = 0; i < N; ++i) {
+                random::normal(g, std::span<T>(z + i * block, m));
+            }
+            // Row i only reads rows j <= i of z, so walking i downward lets
+            // each result overwrite the row it came from.
+            for (std::size_t i = N; i-- > 0; ) {
+                T mu = mean_[i];
+                std::fill_n(y, m, mu);
+                for (std::size_t j = 0; j <= i; ++j) {
+                    T lij = L_(i, j);
+                    const T* zj = z + j * block;
+                    for (std::size_t s = 0; s < m; ++s) {
+                        y[s] += lij * zj[s];
+                    }
+                }
+                std::copy_n(y, m, z + i * block);
+            }
+            for (std::size_t s = 0; s < m; ++s) {
+                for (std::size_t i = 0; i < N; ++i) {
+                    xs[s * N + i] = z[i * block + s];
+                }
+            }
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef MATH_STATS_DIST_NORMAL_HPP
+#define MATH_STATS_DIST_NORMAL_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../core/simd.hpp"
+#include "../../special/erf.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <span>
+
+namespace math::stats::dist {
+
+// Every distribution object validates its parameters once and caches the
+// constants its densities need; invalid parameters make every method return
+// NaN. Batch forms write f(x[i]) to out[i] over min(x.size(), out.size())
+// elements, and those built on simd::exp / simd::log vectorize.
+
+namespace detail {
+
+template<concepts::FloatingPoint T>
+inline constexpr T half_log_two_pi = T{0.918938533204672741780329736406};
+
+}
+
+// Normal(mu, sigma).
+template<concepts::FloatingPoint T>
+class Normal {
+    T mu_;
+    T sigma_;
+    T inv_sigma_;
+    T norm_;
+    T log_norm_;
+
+public:
+    using value_type = T;
+
+    explicit Normal(T mu = T{0}, T sigma = T{1}) : mu_(mu), sigma_(sigma) {
+        if (!(sigma > T{0}) || !std::isfinite(sigma) || !std::isfinite(mu)) {
+            mu_ = sigma_ = std::numeric_limits<T>::quiet_NaN();
+        }
+        inv_sigma_ = T{1} / sigma_;
+        log_norm_ = -std::log(sigma_) - detail::half_log_two_pi<T>;
+        norm_ = std::exp(log_norm_);
+    }
+
+    T mu() const { return mu_; }
+    T sigma() const { return sigma_; }
+    T mean() const { return mu_; }
+    T variance() const { return sigma_ * sigma_; }
+
+    T pdf(T x) const {
+        T z = (x - mu_) * inv_sigma_;
+        return std::exp(T{-0.5} * z * z) * norm_;
+    }
+
+    T logpdf(T x) const {
+        T z = (x - mu_) * inv_sigma_;
+        return log_norm_ - T{0.5} * z * z;
+    }
+
+    T cdf(T x) const {
+        return special::detail::normal_cdf_precise((x - mu_) * inv_sigma_);
+    }
+
+    T sf(T x) const {
+        return special::detail::normal_cdf_precise((mu_ - x) * inv_sigma_);
+    }
+
+    T quantile(T p) const {
+        if (std::isnan(sigma_)) {
+            return sigma_;
+        }
+        return special::normal_quantile(p, mu_, sigma_);
+    }
+
+    void pdf(std::span<const T> x, std::span<T> out) const {
+        T mu = mu_, inv_sigma = inv_sigma_, norm = norm_;
+        simd::transform(x, out, [mu, inv_sigma, norm](T v) {
+            T z = (v - mu) * inv_sigma;
+            return simd::exp(T{-0.5} * z * z) * norm;
+        });
+    }
+
+    void logpdf(std::span<const T> x, std::span<T> out) const {
+        T mu = mu_, inv_sigma = inv_sigma_, log_norm = log_norm_;
+        simd::transform(x, out, [mu, inv_sigma, log_norm](T v) {
+            T z = (v - mu) * inv_sigma;
+            return log_norm - T{0.5} * z * z;
+        });
+    }
+
+    void cdf(std::span<const T> x, std::span<T> out) const {
+        T mu = mu_, inv_sigma = inv_sigma_;
+        simd::transform(x, out, [mu, inv_sigma](T v) {
+            return special::detail::normal_cdf_precise_kernel((v - mu) * inv_sigma);
+        });
+    }
+
+    void sf(std::span<const T> x, std::span<T> out) const {
+        T mu = mu_, inv_sigma = inv_sigma_;
+        simd::transform(x, out, [mu, inv_sigma](T v) {
+            return special::detail::normal_cdf_precise_kernel((mu - v) * inv_sigma);
+        });
+    }
+
+    void quantile(std::span<const T> p, std::span<T> out) const {
+        if (std::isnan(sigma_)) {
+            std::fill_n(out.begin(), std::min(p.size(), out.size()), sigma_);
+            return;
+        }
+        special::normal_quantile(p, out, mu_, sigma_);
+    }
+};
+
+// LogNormal(mu, sigma): log X ~ Normal(mu, sigma). Support x > 0.
+template<concepts::FloatingPoint T>
+class LogNormal {
+    Normal<T> log_;
+
+public:
+    using value_type = T;
+
+    explicit LogNormal(T mu = T{0}, T sigma = T{1}) : log_(mu, sigma) {}
+
+    T mu() const { return log_.mu(); }
+    T sigma() const { return log_.sigma(); }
+
+    T mean() const {
+        return std::exp(log_.mu() + T{0.5} * log_.variance());
+    }
+
+    T variance() const {
+        T s2 = log_.variance();
+        return std::expm1(s2) * std::exp(T{2} * log_.mu() + s2);
+    }
+
+    T pdf(T x) const {
+        if (!(x > T{0})) {
+            return std::isnan(x + log_.mu()) ? std::numeric_limits<T>::quiet_NaN() : T{0};
+        }
+        return log_.pdf(std::log(x)) / x;
+    }
+
+    T logpdf(T x) const {
+        if (!(x > T{0})) {
+            return std::isnan(x + log_.mu()) ? std::numeric_limits<T>::quiet_NaN() : -std::numeric_limits<T>::infinity();
+        }
+        T lx = std::log(x);
+        return log_.logpdf(lx) - lx;
+    }
+
+    T cdf(T x) const {
+        if (!(x > T{0})) {
+            return std::isnan(x + log_.mu()) ? std::numeric_limits<T>::quiet_NaN() : T{0};
+        }
+        return log_.cdf(std::log(x));
+    }
+
+    T sf(T x) const {
+        if (!(x > T{0})) {
+            return std::isnan(x + log_.mu()) ? std::numeric_limits<T>::quiet_NaN() : T{1};
+        }
+        return log_.sf(std::log(x));
+    }
+
+    T quantile(T p) const {
+        return std::exp(log_.quantile(p));
+    }
+
+    // x <= 0 and NaN lanes are patched by the scalar forms.
+    void pdf(std::span<const T> x, std::span<T> out) const {
+        T mu = log_.mu(), inv_sigma = T{1} / log_.sigma(), norm = log_.pdf(mu);
+        simd::transform(x, out, [mu, inv_sigma, norm](T v) {
+            T z = (simd::log(v) - mu) * inv_sigma;
+            return simd::exp(T{-0.5} * z * z) * norm / v;
+        }, [](T v) { return !(v > T{0}); }, [this](T v) { return pdf(v); });
+    }
+
+    void logpdf(std::span<const T> x, std::span<T> out) const {
+        T mu = log_.mu(), inv_sigma = T{1} / log_.sigma(), log_norm = log_.logpdf(mu);
+        simd::transform(x, out, [mu, inv_sigma, log_norm](T v) {
+            T lv = simd::log(v);
+            T z = (lv - mu) * inv_sigma;
+            return log_norm - T{0.5} * z * z - lv;
+        }, [](T v) { return !(v > T{0}); }, [this](T v) { return logpdf(v); });
+    }
+
+    void cdf(std::span<const T> x, std::span<T> out) const {
+        T mu = log_.mu(), inv_sigma = T{1} / log_.sigma();
+        simd::transform(x, out, [mu, inv_sigma](T v) {
+            return special::detail::normal_cdf_precise_kernel((simd::log(v) - mu) * inv_sigma);
+        }, [](T v) { return !(v > T{0}); }, [this](T v) { return cdf(v); });
+    }
+
+    void sf(std::span<const T> x, std::span<T> out) const {
+        T mu = log_.mu(), inv_sigma = T{1} / log_.sigma();
+        simd::transform(x, out, [mu, inv_sigma](T v) {
+            return special::detail::normal_cdf_precise_kernel((mu - simd::log(v)) * inv_sigma);
+        }, [](T v) { return !(v > T{0}); }, [this](T v) { return sf(v); });
+    }
+
+    void quantile(std::span<const T> p, std::span<T> out) const {
+        log_.quantile(p, out);
+        std::size_t n = std::min(p.size(), out.size());
+        simd::transform(std::span<const T>(out.data(), n), out, [](T v) { return simd::exp(v); });
+    }
+};
+
+}
+
+#endif
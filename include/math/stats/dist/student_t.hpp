@@ -0,0 +1,148 @@
+#ifndef MATH_STATS_DIST_STUDENT_T_HPP
+#define MATH_STATS_DIST_STUDENT_T_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../core/simd.hpp"
+#include "../../special/beta.hpp"
+#include "../../special/gamma.hpp"
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <span>
+
+namespace math::stats::dist {
+
+// Student's t with nu > 0 degrees of freedom.
+//   pdf(t) = exp(c - (nu + 1)/2 log(1 + t^2 / nu)),
+//   c = log Gamma((nu + 1)/2) - log Gamma(nu/2) - log(nu pi) / 2.
+// The tails are 0.5 I_(nu / (nu + t^2))(nu/2, 1/2), so each stays accurate
+// on its own side; log B(nu/2, 1/2) is cached for them and the inverse.
+// Both constants come from log Gamma(nu/2 + 1/2) - log Gamma(nu/2) taken
+// as one ratio, which stays accurate as nu grows.
+template<concepts::FloatingPoint T>
+class StudentT {
+    T nu_;
+    T inv_nu_;
+    T half_nu1_;
+    T log_norm_;
+    T log_beta_;
+
+    // P(T > |t|), from x = nu / (nu + t^2) while x <= 1/2 and otherwise
+    // from y = t^2 / (nu + t^2) and the complementary I_y(1/2, nu/2), so
+    // the argument is never a rounded value close to 1.
+    T tail(T t) const {
+        T t2 = t * t;
+        if (t2 == T{0} || std::isinf(t2)) {
+            return t2 == T{0} ? T{0.5} : T{0};
+        }
+        if (t2 < nu_) {
+            return T{0.5} * special::detail::regularized_incomplete_beta(t2 / (nu_ + t2), T{0.5}, T{0.5} * nu_, log_beta_, false);
+        }
+        return T{0.5} * special::detail::regularized_incomplete_beta(nu_ / (nu_ + t2), T{0.5} * nu_, T{0.5}, log_beta_);
+    }
+
+public:
+    using value_type = T;
+
+    explicit StudentT(T nu = T{1}) : nu_(nu) {
+        if (!(nu > T{0}) || !std::isfinite(nu)) {
+            nu_ = std::numeric_limits<T>::quiet_NaN();
+        }
+        inv_nu_ = T{1} / nu_;
+        half_nu1_ = T{0.5} * (nu_ + T{1});
+        T ratio = special::log_gamma_half_ratio(T{0.5} * nu_);
+        log_norm_ = ratio - T{0.5} * std::log(nu_ * std::numbers::pi_v<T>);
+        log_beta_ = T{0.5} * std::log(std::numbers::pi_v<T>) - ratio;
+    }
+
+    T dof() const { return nu_; }
+    T mean() const { return nu_ > T{1} ? T{0} : std::numeric_limits<T>::quiet_NaN(); }
+
+    T variance() const {
+        if (nu_ > T{2}) {
+            return nu_ / (nu_ - T{2});
+        }
+        return nu_ > T{1} ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::quiet_NaN();
+    }
+
+    T pdf(T x) const {
+        return std::exp(logpdf(x));
+    }
+
+    T logpdf(T x) const {
+        return log_norm_ - half_nu1_ * std::log1p(x * x * inv_nu_);
+    }
+
+    T cdf(T x) const {
+        if (std::isnan(x) || std::isnan(nu_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        T p = tail(x);
+        return x < T{0} ? p : T{1} - p;
+    }
+
+    T sf(T x) const {
+        if (std::isnan(x) || std::isnan(nu_)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        T p = tail(x);
+        return x > T{0} ? p : T{1} - p;
+    }
+
+    // With q = min(p, 1 - p), |t| comes from x = I^-1(2q; nu/2, 1/2) when
+    // the root has x = nu / (nu + t^2) <= 1/2, that is when 2q is at most
+    // the two-sided tail at t^2 = nu; otherwise from y = 1 - x as the root
+    // of 1 - I_y(1/2, nu/2) = 2q, where 1 - x would cancel.
+    T quantile(T p) const {
+        if (!(p > T{0} && p < T{1}) || std::isnan(nu_)) {
+            if (std::isnan(nu_) || !(p == T{0} || p == T{1})) {
+                return std::numeric_limits<T>::quiet_NaN();
+            }
+            return p == T{0} ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+        }
+        if (p == T{0.5}) {
+            return T{0};
+        }
+        T q = p < T{0.5} ? p : T{1} - p;
+        T t2;
+        if (q <= tail(std::sqrt(nu_))) {
+            T x = special::detail::regularized_incomplete_beta_inv(T{2} * q, T{0.5} * nu_, T{0.5}, log_beta_);
+            t2 = nu_ * (T{1} - x) / x;
+        } else {
+            T y = special::detail::regularized_incomplete_beta_inv(T{2} * q, T{0.5}, T{0.5} * nu_, log_beta_, false);
+            t2 = nu_ * y / (T{1} - y);
+        }
+        T t = std::sqrt(t2);
+        return p < T{0.5} ? -t : t;
+    }
+
+    void pdf(std::span<const T> x, std::span<T> out) const {
+        T c = log_norm_, h = half_nu1_, inv_nu = inv_nu_;
+        simd::transform(x, out, [c, h, inv_nu](T v) {
+            return simd::exp(c - h * simd::log(T{1} + v * v * inv_nu));
+        });
+    }
+
+    void logpdf(std::span<const T> x, std::span<T> out) const {
+        T c = log_norm_, h = half_nu1_, inv_nu = inv_nu_;
+        simd::transform(x, out, [c, h, inv_nu](T v) {
+            return c - h * simd::log(T{1} + v * v * inv_nu);
+        });
+    }
+
+    void cdf(std::span<const T> x, std::span<T> out) const {
+        simd::transform(x, out, [this](T v) { return cdf(v); });
+    }
+
+    void sf(std::span<const T> x, std::span<T> out) const {
+        simd::transform(x, out, [this](T v) { return sf(v); });
+    }
+
+    void quantile(std::span<const T> p, std::span<T> out) const {
+        simd::transform(p, out, [this](T v) { return quantile(v); });
+    }
+};
+
+}
+
+#endif
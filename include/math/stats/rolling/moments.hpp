@@ -0,0 +1,217 @@
+#ifndef MATH_STATS_ROLLING_MOMENTS_HPP
+#define MATH_STATS_ROLLING_MOMENTS_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../core/summation.hpp"
+#include "window.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+namespace math::stats::rolling {
+
+namespace detail {
+
+// Window sum kept as an unevaluated pair sum + comp (TwoSum on every add
+// and remove), so the cancellation between values entering and leaving
+// does not accumulate rounding error across a long series.
+template<concepts::FloatingPoint T>
+class CompensatedSum {
+    T sum_ = T{0};
+    T comp_ = T{0};
+
+public:
+    void add(T x) {
+        T s;
+        T e;
+        summation::detail::two_sum(sum_, x, s, e);
+        sum_ = s;
+        comp_ += e;
+    }
+
+    void reset(std::span<const T> values) {
+        sum_ = T{0};
+        comp_ = T{0};
+        for (T v : values) {
+            add(v);
+        }
+    }
+
+    T value() const { return sum_ + comp_; }
+};
+
+}
+
+// Moving average over the last `window` values, O(1) per push. Once the
+// window is full it is re-summed from scratch every `window` pushes (O(1)
+// amortized), so a NaN or inf stops affecting the result at most one
+// window after it leaves.
+template<concepts::FloatingPoint T>
+class Mean {
+    detail::Ring<T> window_;
+    detail::CompensatedSum<T> sum_;
+    std::size_t since_resync_ = 0;
+
+public:
+    using value_type = T;
+
+    explicit Mean(std::size_t window) : window_(window) {}
+
+    T push(T x) {
+        if (window_.full()) {
+            if (++since_resync_ == window_.capacity()) {
+                window_.push(x);
+                sum_.reset(window_.values());
+                since_resync_ = 0;
+                return value();
+            }
+            sum_.add(-window_.oldest());
+        }
+        sum_.add(x);
+        window_.push(x);
+        return value();
+    }
+
+    T value() const {
+        return window_.size() == 0 ? T{0} : sum_.value() / static_cast<T>(window_.size());
+    }
+
+    std::size_t window() const { return window_.capacity(); }
+    std::size_t size() const { return window_.size(); }
+};
+
+// Moving variance over the last `window` values (sample form by default,
+// 0 while fewer than two values are in). While filling it is Welford's
+// update; once full, each push replaces the oldest value x_o by x with
+// M2 += (x - x_o)(x - mean' + x_o - mean), the exact change in the sum of
+// squared deviations, and the mean comes from a compensated window sum.
+// A two-pass recomputation every `window` pushes bounds the drift.
+template<concepts::FloatingPoint T>
+class Variance {
+    detail::Ring<T> window_;
+    detail::CompensatedSum<T> sum_;
+    T mean_ = T{0};
+    T m2_ = T{0};
+    std::size_t since_resync_ = 0;
+    bool sample_;
+
+    void resync() {
+        auto v = window_.values();
+        sum_.reset(v);
+        mean_ = sum_.value() / static_cast<T>(v.size());
+        m2_ = T{0};
+        for (T x : v) {
+            m2_ += (x - mean_) * (x - mean_);
+        }
+        since_resync_ = 0;
+    }
+
+public:
+    using value_type = T;
+
+    explicit Variance(std::size_t window, bool sample = true) : window_(window), sample_(sample) {}
+
+    T push(T x) {
+        if (!window_.full()) {
+            window_.push(x);
+            sum_.add(x);
+            T d = x - mean_;
+            mean_ += d / static_cast<T>(window_.size());
+            m2_ += d * (x - mean_);
+            return value();
+        }
+        T out = window_.oldest();
+        window_.push(x);
+        if (++since_resync_ == window_.capacity()) {
+            resync();
+            return value();
+        }
+        sum_.add(x);
+        sum_.add(-out);
+        T mean = sum_.value() / static_cast<T>(window_.size());
+        m2_ += (x - out) * (x - mean + out - mean_);
+        mean_ = mean;
+        return value();
+    }
+
+    T value() const {
+        std::size_t n = window_.size();
+        if (n == 0 || (sample_ && n == 1)) {
+            return T{0};
+        }
+        return std::max(m2_, T{0}) / static_cast<T>(sample_ ? n - 1 : n);
+    }
+
+    T mean() const { return mean_; }
+    T std_dev() const { return std::sqrt(value()); }
+    std::size_t window() const { return window_.capacity(); }
+    std::size_t size() const { return window_.size(); }
+};
+
+// Exponentially weighted mean: m <- m + alpha (x - m), starting from the
+// first value. alpha = 1 - exp(-ln 2 / halflife) for a half-life in
+// samples, or 2 / (span + 1) for the usual span convention.
+template<concepts::FloatingPoint T>
+class EwmMean {
+    T alpha_;
+    T mean_ = T{0};
+    bool started_ = false;
+
+public:
+    using value_type = T;
+
+    explicit EwmMean(T alpha) : alpha_(alpha) {}
+
+    T push(T x) {
+        if (!started_) {
+            mean_ = x;
+            started_ = true;
+        } else {
+            mean_ += alpha_ * (x - mean_);
+        }
+        return mean_;
+    }
+
+    T value() const { return mean_; }
+    T alpha() const { return alpha_; }
+};
+
+// Exponentially weighted variance by West's incremental form (1979):
+// d = x - m, m <- m + alpha d, v <- (1 - alpha)(v + alpha d^2). This is
+// the weighted population variance with no bias correction; it never goes
+// negative and needs no history.
+template<concepts::FloatingPoint T>
+class EwmVariance {
+    T alpha_;
+    T mean_ = T{0};
+    T var_ = T{0};
+    bool started_ = false;
+
+public:
+    using value_type = T;
+
+    explicit EwmVariance(T alpha) : alpha_(alpha) {}
+
+    T push(T x) {
+        if (!started_) {
+            mean_ = x;
+            started_ = true;
+            return var_;
+        }
+        T d = x - mean_;
+        T incr = alpha_ * d;
+        mean_ += incr;
+        var_ = (T{1} - alpha_) * (var_ + d * incr);
+        return var_;
+    }
+
+    T value() const { return var_; }
+    T mean() const { return mean_; }
+    T std_dev() const { return std::sqrt(var_); }
+    T alpha() const { return alpha_; }
+};
+
+}
+
+#endif
@@ -0,0 +1,231 @@
+#ifndef MATH_STATS_ROLLING_ORDER_HPP
+#define MATH_STATS_ROLLING_ORDER_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "window.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace math::stats::rolling {
+
+namespace detail {
+
+// Sliding-window extremum by a monotonic deque (Lemire, "Streaming
+// maximum-minimum filter using no more than three comparisons per
+// element", 2006): the deque holds the values that can still become the
+// extremum, in arrival order and strictly ordered by Before, so the front
+// is the answer and each value is pushed and popped at most once. The
+// deque lives in a fixed ring of window + 1 entries.
+template<concepts::Arithmetic T, typename Before>
+class Extremum {
+    struct Entry {
+        std::uint64_t time;
+        T value;
+    };
+
+    std::vector<Entry> ring_;
+    std::size_t window_;
+    std::size_t front_ = 0;
+    std::size_t count_ = 0;
+    std::uint64_t time_ = 0;
+
+    std::size_t wrap(std::size_t i) const { return i >= ring_.size() ? i - ring_.size() : i; }
+
+public:
+    using value_type = T;
+
+    explicit Extremum(std::size_t window)
+        : ring_(std::max<std::size_t>(window, 1) + 1), window_(std::max<std::size_t>(window, 1)) {}
+
+    T push(T x) {
+        while (count_ > 0 && !Before{}(ring_[wrap(front_ + count_ - 1)].value, x)) {
+            --count_;
+        }
+        ring_[wrap(front_ + count_)] = {time_, x};
+        ++count_;
+        if (ring_[front_].time + window_ <= time_) {
+            front_ = wrap(front_ + 1);
+            --count_;
+        }
+        ++time_;
+        return ring_[front_].value;
+    }
+
+    T value() const { return ring_[front_].value; }
+    std::size_t window() const { return window_; }
+};
+
+}
+
+// Moving minimum and maximum, amortized O(1) per push. A NaN never
+// compares as smaller or larger, so it drops out of the deque as soon as
+// any later value arrives; windows should be NaN-free.
+template<concepts::Arithmetic T>
+using Min = detail::Extremum<T, std::less<T>>;
+
+template<concepts::Arithmetic T>
+using Max = detail::Extremum<T, std::greater<T>>;
+
+// Moving q-quantile, with the interpolation of descriptive::quantile:
+// pos = q (n - 1) over the n values in the window, interpolating between
+// order statistics floor(pos) and floor(pos) + 1. The default q = 0.5 is
+// the rolling median.
+//
+// Two indexed heaps split the window: `lo_`, a max-heap of the
+// floor(pos) + 1 smallest values, and `hi_`, a min-heap of the rest, so
+// the answer is at their roots. The heaps store window slots, and every
+// slot knows its heap position, so once the window is full a push
+// overwrites the oldest value in place and restores order with one sift
+// and at most one exchange of roots: O(log w) with no allocation and no
+// lazy deletion.
+template<concepts::FloatingPoint T>
+class Quantile {
+    detail::Ring<T> window_;
+    double q_;
+    std::vector<std::size_t> lo_;
+    std::vector<std::size_t> hi_;
+    // Position of each slot in its heap, and which heap.
+    std::vector<std::size_t> pos_;
+    std::vector<std::uint8_t> in_lo_;
+
+    bool above(bool lo, std::size_t a, std::size_t b) const {
+        return lo ? window_[a] > window_[b] : window_[a] < window_[b];
+    }
+
+    std::vector<std::size_t>& heap(bool lo) { return lo ? lo_ : hi_; }
+
+    void place(bool lo, std::size_t i, std::size_t slot) {
+        heap(lo)[i] = slot;
+        pos_[slot] = i;
+        in_lo_[slot] = lo ? 1 : 0;
+    }
+
+    void sift_up(bool lo, std::size_t i) {
+        auto& h = heap(lo);
+        std::size_t slot = h[i];
+        while (i > 0) {
+            std::size_t parent = (i - 1) / 2;
+            if (!above(lo, slot, h[parent])) {
+                break;
+            }
+            place(lo, i, h[parent]);
+            i = parent;
+        }
+        place(lo, i, slot);
+    }
+
+    void sift_down(bool lo, std::size_t i) {
+        auto& h = heap(lo);
+        std::size_t slot = h[i];
+        std::size_t n = h.size();
+        for (;;) {
+            std::size_t child = 2 * i + 1;
+            if (child >= n) {
+                break;
+            }
+            if (child + 1 < n && above(lo, h[child + 1], h[child])) {
+                ++child;
+            }
+            if (!above(lo, h[child], slot)) {
+                break;
+            }
+            place(lo, i, h[child]);
+            i = child;
+        }
+        place(lo, i, slot);
+    }
+
+    void insert(bool lo, std::size_t slot) {
+        heap(lo).push_back(slot);
+        sift_up(lo, heap(lo).size() - 1);
+    }
+
+    std::size_t pop(bool lo) {
+        auto& h = heap(lo);
+        std::size_t top = h[0];
+        std::size_t last = h.back();
+        h.pop_back();
+        if (!h.empty()) {
+            place(lo, 0, last);
+            sift_down(lo, 0);
+        }
+        return top;
+    }
+
+    // If the roots are out of order (largest of lo_ above smallest of
+    // hi_), swap them between the heaps.
+    void fix_roots() {
+        if (lo_.empty() || hi_.empty() || !(window_[lo_[0]] > window_[hi_[0]])) {
+            return;
+        }
+        std::size_t a = lo_[0];
+        std::size_t b = hi_[0];
+        place(true, 0, b);
+        place(false, 0, a);
+        sift_down(true, 0);
+        sift_down(false, 0);
+    }
+
+    std::size_t lower_rank(std::size_t n) const {
+        return static_cast<std::size_t>(std::floor(q_ * static_cast<double>(n - 1)));
+    }
+
+public:
+    using value_type = T;
+
+    Quantile(std::size_t window, double q = 0.5)
+        : window_(window), q_(std::clamp(q, 0.0, 1.0)),
+          pos_(window_.capacity()), in_lo_(window_.capacity()) {
+        lo_.reserve(window_.capacity());
+        hi_.reserve(window_.capacity());
+    }
+
+    T push(T x) {
+        if (window_.full()) {
+            std::size_t slot = window_.push(x);
+            bool lo = in_lo_[slot] != 0;
+            sift_up(lo, pos_[slot]);
+            sift_down(lo, pos_[slot]);
+            fix_roots();
+            return value();
+        }
+        std::size_t slot = window_.push(x);
+        insert(!lo_.empty() && window_[slot] <= window_[lo_[0]], slot);
+        std::size_t target = lower_rank(window_.size()) + 1;
+        while (lo_.size() > target) {
+            insert(false, pop(true));
+        }
+        while (lo_.size() < target) {
+            insert(true, pop(false));
+        }
+        return value();
+    }
+
+    T value() const {
+        std::size_t n = window_.size();
+        if (n == 0) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        double pos = q_ * static_cast<double>(n - 1);
+        double weight = pos - static_cast<double>(lower_rank(n));
+        T lo = window_[lo_[0]];
+        if (weight == 0.0 || hi_.empty()) {
+            return lo;
+        }
+        T hi = window_[hi_[0]];
+        return static_cast<T>(lo * (1.0 - weight) + hi * weight);
+    }
+
+    double q() const { return q_; }
+    std::size_t window() const { return window_.capacity(); }
+    std::size_t size() const { return window_.size(); }
+};
+
+}
+
+#endif
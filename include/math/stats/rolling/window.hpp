@@ -0,0 +1,85 @@
+#ifndef MATH_STATS_ROLLING_WINDOW_HPP
+#define MATH_STATS_ROLLING_WINDOW_HPP
+
+#include "../../exec/parallel.hpp"
+#include "../../exec/policy.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace math::stats::rolling {
+
+namespace detail {
+
+// The last `capacity` values of a stream, in a fixed circular buffer.
+// Slots are stable: a value keeps its slot until it is overwritten by the
+// value `capacity` pushes later, which lets order statistics index into
+// the window by slot.
+template<typename T>
+class Ring {
+    std::vector<T> buf_;
+    std::size_t head_ = 0;
+    std::size_t size_ = 0;
+
+public:
+    explicit Ring(std::size_t capacity) : buf_(std::max<std::size_t>(capacity, 1)) {}
+
+    std::size_t capacity() const { return buf_.size(); }
+    std::size_t size() const { return size_; }
+    bool full() const { return size_ == buf_.size(); }
+
+    // Slot the next push writes; when full, it holds the value about to
+    // leave the window.
+    std::size_t next_slot() const { return head_; }
+    const T& oldest() const { return buf_[head_]; }
+
+    const T& operator[](std::size_t slot) const { return buf_[slot]; }
+    std::span<const T> values() const { return std::span<const T>(buf_.data(), size_); }
+
+    std::size_t push(T x) {
+        std::size_t slot = head_;
+        buf_[slot] = x;
+        head_ = head_ + 1 == buf_.size() ? 0 : head_ + 1;
+        size_ += size_ < buf_.size() ? 1 : 0;
+        return slot;
+    }
+};
+
+}
+
+// The statistics in this module share one shape: constructed with their
+// window (or decay) parameter, push(x) takes the next value and returns the
+// statistic over the trailing window, which is partial for the first
+// window - 1 values.
+
+// out[i] = stat.push(in[i]) for i < min(in.size(), out.size()); stat keeps
+// its state, so a long series can be fed in pieces.
+template<typename Stat, typename T>
+void apply(Stat& stat, std::span<const T> in, std::span<T> out) {
+    std::size_t n = std::min(in.size(), out.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = stat.push(in[i]);
+    }
+}
+
+// Independent series of `length` points each, stored back to back in in,
+// with out laid out the same way. Each series runs through its own copy of
+// prototype, and the series are spread over the policy's workers.
+template<exec::ExecutionPolicy Policy, typename Stat, typename T>
+void apply(const Policy& policy, const Stat& prototype, std::span<const T> in, std::size_t length, std::span<T> out) {
+    if (length == 0) {
+        return;
+    }
+    std::size_t series = std::min(in.size(), out.size()) / length;
+    exec::parallel_for(policy, 0, series, 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t s = first; s < last; ++s) {
+            Stat stat = prototype;
+            apply(stat, in.subspan(s * length, length), out.subspan(s * length, length));
+        }
+    });
+}
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef MATH_STATS_SKETCH_BYTES_HPP
+#define MATH_STATS_SKETCH_BYTES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace math::stats::sketch::detail {
+
+// Flat, host-byte-order encoding for the sketches: a four-byte tag, the
+// size of the value type, then fixed-size fields and length-prefixed
+// arrays. Bytes are meant to move between processes on like machines, not
+// to be a portable archive format.
+class ByteWriter {
+    std::vector<std::byte> out_;
+
+public:
+    template<typename V>
+        requires std::is_trivially_copyable_v<V>
+    void put(const V& v) {
+        std::size_t at = out_.size();
+        out_.resize(at + sizeof(V));
+        std::memcpy(out_.data() + at, &v, sizeof(V));
+    }
+
+    template<typename V>
+        requires std::is_trivially_copyable_v<V>
+    void put_array(std::span<const V> values) {
+        put(static_cast<std::uint64_t>(values.size()));
+        std::size_t at = out_.size();
+        out_.resize(at + values.size_bytes());
+        if (!values.empty()) {
+            std::memcpy(out_.data() + at, values.data(), values.size_bytes());
+        }
+    }
+
+    std::vector<std::byte> take() { return std::move(out_); }
+};
+
+// Reads what ByteWriter wrote. Every read is bounds-checked; the first
+// failure latches ok() to false and later reads yield zeros, so a decoder
+// can read every field and check once at the end.
+class ByteReader {
+    std::span<const std::byte> in_;
+    bool ok_ = true;
+
+public:
+    explicit ByteReader(std::span<const std::byte> in) : in_(in) {}
+
+    template<typename V>
+        requires std::is_trivially_copyable_v<V>
+    V get() {
+        V v{};
+        if (!ok_ || in_.size() < sizeof(V)) {
+            ok_ = false;
+            return v;
+        }
+        std::memcpy(&v, in_.data(), sizeof(V));
+        in_ = in_.subspan(sizeof(V));
+        return v;
+    }
+
+    // At most max_count elements; a longer array marks the input bad.
+    template<typename V>
+        requires std::is_trivially_copyable_v<V>
+    std::vector<V> get_array(std::size_t max_count) {
+        std::uint64_t n = get<std::uint64_t>();
+        if (!ok_ || n > max_count || in_.size() / sizeof(V) < n) {
+            ok_ = false;
+            return {};
+        }
+        std::vector<V> v(static_cast<std::size_t>(n));
+        if (n > 0) {
+            std::memcpy(v.data(), in_.data(), v.size() * sizeof(V));
+        }
+        in_ = in_.subspan(v.size() * sizeof(V));
+        return v;
+    }
+
+    bool ok() const { return ok_; }
+
+    // True once everything has been read successfully.
+    bool done() const { return ok_ && in_.empty(); }
+};
+
+inline constexpr std::uint32_t tag(char a, char b, char c, char d) {
+    return static_cast<std::uint32_t>(static_cast<unsigned char>(a))
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(b)) << 8
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(c)) << 16
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(d)) << 24;
+}
+
+}
+
+#endif
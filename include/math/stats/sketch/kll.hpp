@@ -0,0 +1,354 @@
+#ifndef MATH_STATS_SKETCH_KLL_HPP
+#define MATH_STATS_SKETCH_KLL_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "../../random/engine.hpp"
+#include "bytes.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace math::stats::sketch {
+
+// Karnin, Lang and Liberty's quantile sketch ("Optimal Quantile
+// Approximation in Streams", 2016). Level h is a buffer of values that
+// each stand for 2^h inputs. A level that reaches its capacity is sorted
+// and compacted: a fair coin picks the odd or the even positions, those
+// move up a level with doubled weight and the rest are dropped. Capacities
+// shrink geometrically, by 2/3 per level below the top (k at the top), so
+// the whole sketch holds under about 3k values however long the stream.
+//
+// A compaction at level h shifts the rank of any one query point by
+// exactly 0 or +-2^h with a fair sign, so the rank error is a martingale
+// whose variance the sketch can count as it goes; rank_error() turns that
+// into a bound that holds with the requested probability for each query,
+// including after merges. NaNs are ignored.
+template<concepts::Arithmetic T>
+class KllSketch {
+    static constexpr std::uint32_t tag = detail::tag('K', 'L', 'L', '1');
+
+    std::uint32_t k_;
+    std::uint64_t n_ = 0;
+    T min_ = std::numeric_limits<T>::max();
+    T max_ = std::numeric_limits<T>::lowest();
+    // The constructor's seed, for clear(); coin_ has moved on from it.
+    std::uint64_t seed_;
+    random::SplitMix64 coin_;
+    std::vector<std::vector<T>> levels_;
+    // Compactions performed at each level, for rank_error().
+    std::vector<std::uint64_t> compactions_;
+    // capacity_[h] = max(8, ceil(k (2/3)^depth)), depth counted down from
+    // the top level; recomputed whenever a level is added.
+    std::vector<std::size_t> capacity_;
+    std::size_t size_ = 0;
+    std::size_t max_size_ = 0;
+
+    void grow() {
+        levels_.emplace_back();
+        compactions_.push_back(0);
+        capacity_.resize(levels_.size());
+        max_size_ = 0;
+        double c = static_cast<double>(k_);
+        for (std::size_t h = levels_.size(); h-- > 0; ) {
+            capacity_[h] = std::max<std::size_t>(8, static_cast<std::size_t>(std::ceil(c)));
+            max_size_ += capacity_[h];
+            c *= 2.0 / 3.0;
+        }
+    }
+
+    // Sorts level h and moves every other value, from a random start, up
+    // to level h + 1; with an odd count the smallest value stays behind.
+    void compact(std::size_t h) {
+        if (h + 1 == levels_.size()) {
+            grow();
+        }
+        auto& level = levels_[h];
+        std::sort(level.begin(), level.end());
+        std::size_t keep = level.size() % 2;
+        std::size_t start = keep + static_cast<std::size_t>(coin_() >> 63);
+        auto& up = levels_[h + 1];
+        for (std::size_t i = start; i < level.size(); i += 2) {
+            up.push_back(level[i]);
+        }
+        size_ -= level.size() - keep;
+        size_ += (level.size() - keep) / 2;
+        level.resize(keep);
+        ++compactions_[h];
+    }
+
+    void compress() {
+        while (size_ >= max_size_) {
+            for (std::size_t h = 0; h < levels_.size(); ++h) {
+                if (levels_[h].size() >= capacity_[h]) {
+                    compact(h);
+                    break;
+                }
+            }
+        }
+    }
+
+    void record(T x) {
+        ++n_;
+        min_ = std::min(min_, x);
+        max_ = std::max(max_, x);
+    }
+
+    // Every retained value with its weight, sorted by value.
+    std::vector<std::pair<T, std::uint64_t>> sorted_view() const {
+        std::vector<std::pair<T, std::uint64_t>> v;
+        v.reserve(size_);
+        for (std::size_t h = 0; h < levels_.size(); ++h) {
+            for (T x : levels_[h]) {
+                v.emplace_back(x, std::uint64_t{1} << h);
+            }
+        }
+        std::sort(v.begin(), v.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        return v;
+    }
+
+    T quantile_from(const std::vector<std::pair<T, std::uint64_t>>& view, double q) const {
+        if (n_ == 0 || !(q >= 0.0 && q <= 1.0)) {
+            return invalid();
+        }
+        if (q == 0.0) {
+            return min_;
+        }
+        if (q == 1.0) {
+            return max_;
+        }
+        double target = q * static_cast<double>(n_);
+        double total = 0.0;
+        for (const auto& [x, w] : view) {
+            total += static_cast<double>(w);
+            if (total >= target) {
+                return x;
+            }
+        }
+        return max_;
+    }
+
+    static T invalid() {
+        if constexpr (std::numeric_limits<T>::has_quiet_NaN) {
+            return std::numeric_limits<T>::quiet_NaN();
+        } else {
+            return T{0};
+        }
+    }
+
+public:
+    using value_type = T;
+
+    // k sets the top level's capacity; the rank error falls roughly as
+    // 1 / k. seed fixes the compaction coin, so equal inputs give equal
+    // sketches.
+    explicit KllSketch(std::uint32_t k = 200, std::uint64_t seed = 0)
+        : k_(std::max<std::uint32_t>(k, 8)), seed_(seed), coin_(seed) {
+        grow();
+    }
+
+    void push(T x) {
+        if constexpr (std::numeric_limits<T>::has_quiet_NaN) {
+            if (std::isnan(x)) {
+                return;
+            }
+        }
+        record(x);
+        levels_[0].push_back(x);
+        if (++size_ >= max_size_) {
+            compress();
+        }
+    }
+
+    // Appends straight into level 0 up to the next compaction at a time.
+    void push(std::span<const T> data) {
+        std::size_t i = 0;
+        while (i < data.size()) {
+            std::size_t room = max_size_ - size_;
+            std::size_t end = std::min(data.size(), i + room);
+            auto& level = levels_[0];
+            std::size_t before = level.size();
+            for (; i < end; ++i) {
+                T x = data[i];
+                if constexpr (std::numeric_limits<T>::has_quiet_NaN) {
+                    if (std::isnan(x)) {
+                        continue;
+                    }
+                }
+                record(x);
+                level.push_back(x);
+            }
+            size_ += level.size() - before;
+            if (size_ >= max_size_) {
+                compress();
+            }
+        }
+    }
+
+    // Folds other in level by level; the result keeps this sketch's k.
+    // Merging a sketch into itself folds in a copy, since the levels are
+    // appended to while they are read.
+    void merge(const KllSketch& other) {
+        if (other.n_ == 0) {
+            return;
+        }
+        if (&other == this) {
+            KllSketch copy = other;
+            merge(copy);
+            return;
+        }
+        while (levels_.size() < other.levels_.size()) {
+            grow();
+        }
+        for (std::size_t h = 0; h < other.levels_.size(); ++h) {
+            levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+            size_ += other.levels_[h].size();
+            compactions_[h] += other.compactions_[h];
+        }
+        n_ += other.n_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        compress();
+    }
+
+    void clear() { *this = KllSketch(k_, seed_); }
+
+    std::uint64_t count() const { return n_; }
+    std::uint32_t k() const { return k_; }
+    T min() const { return min_; }
+    T max() const { return max_; }
+
+    // Values currently held, summed over all levels.
+    std::size_t retained() const { return size_; }
+
+    // Estimated number of inputs <= x.
+    std::uint64_t rank(T x) const {
+        std::uint64_t r = 0;
+        for (std::size_t h = 0; h < levels_.size(); ++h) {
+            std::uint64_t c = 0;
+            for (T v : levels_[h]) {
+                c += v <= x ? 1 : 0;
+            }
+            r += c << h;
+        }
+        return r;
+    }
+
+    // Estimated fraction of inputs <= x; exact outside [min, max].
+    double cdf(T x) const {
+        if (n_ == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (x < min_) {
+            return 0.0;
+        }
+        if (x >= max_) {
+            return 1.0;
+        }
+        return static_cast<double>(rank(x)) / static_cast<double>(n_);
+    }
+
+    // The smallest retained value whose estimated rank reaches q n; q = 0
+    // and q = 1 give the exact min and max. NaN (0 for integer T) when
+    // empty or q is outside [0, 1].
+    T quantile(double q) const {
+        return quantile_from(sorted_view(), q);
+    }
+
+    // Several quantiles from one sorted view of the sketch.
+    void quantiles(std::span<const double> qs, std::span<T> out) const {
+        auto view = sorted_view();
+        std::size_t m = std::min(qs.size(), out.size());
+        for (std::size_t i = 0; i < m; ++i) {
+            out[i] = quantile_from(view, qs[i]);
+        }
+    }
+
+    // Normalized rank error e such that, for any single query, |cdf(x) -
+    // true cdf(x)| <= e with probability at least `confidence`. From
+    // Azuma-Hoeffding over the compactions done so far: the shifts are
+    // zero-mean and bounded by 2^h, so P(|err| >= t) <= 2 exp(-t^2 /
+    // (2 sum_h c_h 4^h)). The same e bounds the rank of quantile(q)
+    // against q.
+    double rank_error(double confidence = 0.99) const {
+        if (n_ == 0) {
+            return 0.0;
+        }
+        double variance = 0.0;
+        for (std::size_t h = 0; h < compactions_.size(); ++h) {
+            variance += static_cast<double>(compactions_[h]) * std::ldexp(1.0, 2 * static_cast<int>(h));
+        }
+        double delta = std::clamp(1.0 - confidence, 1e-300, 1.0);
+        return std::sqrt(2.0 * variance * std::log(2.0 / delta)) / static_cast<double>(n_);
+    }
+
+    std::vector<std::byte> serialize() const {
+        detail::ByteWriter w;
+        w.put(tag);
+        w.put(static_cast<std::uint32_t>(sizeof(T)));
+        w.put(k_);
+        w.put(n_);
+        w.put(min_);
+        w.put(max_);
+        w.put(seed_);
+        w.put(coin_.state());
+        w.put(static_cast<std::uint32_t>(levels_.size()));
+        for (const auto& level : levels_) {
+            w.put_array(std::span<const T>(level));
+        }
+        w.put_array(std::span<const std::uint64_t>(compactions_));
+        return w.take();
+    }
+
+    // The sketch serialize() wrote, or nullopt for bytes that are
+    // truncated, from a different value type or internally inconsistent.
+    static std::optional<KllSketch> deserialize(std::span<const std::byte> bytes) {
+        detail::ByteReader r(bytes);
+        if (r.get<std::uint32_t>() != tag || r.get<std::uint32_t>() != sizeof(T)) {
+            return std::nullopt;
+        }
+        std::uint32_t k = r.get<std::uint32_t>();
+        std::uint64_t n = r.get<std::uint64_t>();
+        T lo = r.get<T>();
+        T hi = r.get<T>();
+        std::uint64_t seed = r.get<std::uint64_t>();
+        std::uint64_t coin = r.get<std::uint64_t>();
+        std::uint32_t height = r.get<std::uint32_t>();
+        if (!r.ok() || k < 8 || height == 0 || height > 64) {
+            return std::nullopt;
+        }
+        KllSketch s(k, seed);
+        s.coin_ = random::SplitMix64(coin);
+        s.n_ = n;
+        s.min_ = lo;
+        s.max_ = hi;
+        while (s.levels_.size() < height) {
+            s.grow();
+        }
+        std::uint64_t weight = 0;
+        for (std::size_t h = 0; h < height; ++h) {
+            s.levels_[h] = r.get_array<T>(s.max_size_);
+            s.size_ += s.levels_[h].size();
+            weight += static_cast<std::uint64_t>(s.levels_[h].size()) << h;
+        }
+        s.compactions_ = r.get_array<std::uint64_t>(height);
+        if (!r.done() || s.compactions_.size() != height || s.size_ >= s.max_size_) {
+            return std::nullopt;
+        }
+        // Compaction turns two values of weight 2^h into one of 2^(h+1),
+        // so the retained weight is always exactly n.
+        if (weight != n || (n > 0 && !(lo <= hi))) {
+            return std::nullopt;
+        }
+        return s;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,323 @@
+#ifndef MATH_STATS_SKETCH_TDIGEST_HPP
+#define MATH_STATS_SKETCH_TDIGEST_HPP
+
+#include "../../core/concepts/arithmetic.hpp"
+#include "bytes.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace math::stats::sketch {
+
+// Dunning and Ertl's merging t-digest ("Computing extremely accurate
+// quantiles using t-digests", 2019) with the k1 scale function
+// k(q) = delta / (2 pi) asin(2q - 1). The distribution is held as at most
+// about `compression` centroids (mean, weight), sorted by mean, where a
+// centroid may span only one unit of k: centroids are small near q = 0 and
+// q = 1 and wide in the middle, so tail quantiles stay accurate.
+//
+// New values collect in a buffer of 5 * compression entries; a full buffer
+// is sorted and merged with the centroids in one linear pass, so an insert
+// costs O(log compression) amortized and memory is fixed by compression.
+// Queries fold any buffered values in first, so they are logically const
+// but not safe to call concurrently on one digest. NaNs are ignored.
+template<concepts::FloatingPoint T>
+class TDigest {
+public:
+    struct Centroid {
+        T mean;
+        T weight;
+    };
+
+private:
+    static constexpr std::uint32_t tag = detail::tag('T', 'D', 'G', '1');
+
+    T delta_;
+    std::uint64_t n_ = 0;
+    T min_ = std::numeric_limits<T>::infinity();
+    T max_ = -std::numeric_limits<T>::infinity();
+    mutable std::vector<Centroid> centroids_;
+    mutable std::vector<T> buffer_;
+
+    std::size_t buffer_capacity() const {
+        return static_cast<std::size_t>(std::ceil(5 * delta_)) + 8;
+    }
+
+    // Upper end, as a fraction of the total weight, of a centroid that
+    // starts at q0: one unit of k further on.
+    T q_limit(T q0) const {
+        constexpr T two_pi = 2 * std::numbers::pi_v<T>;
+        T k = delta_ / two_pi * std::asin(std::clamp(2 * q0 - 1, T{-1}, T{1})) + 1;
+        if (k >= delta_ / 4) {
+            return T{1};
+        }
+        return (std::sin(two_pi * k / delta_) + 1) / 2;
+    }
+
+    // Greedy left-to-right merge of mean-sorted centroids under the k1
+    // size limit.
+    void compress(const std::vector<Centroid>& all) const {
+        centroids_.clear();
+        if (all.empty()) {
+            return;
+        }
+        T total = T{0};
+        for (const auto& c : all) {
+            total += c.weight;
+        }
+        Centroid cur = all[0];
+        T before = T{0};
+        T limit = q_limit(T{0}) * total;
+        for (std::size_t i = 1; i < all.size(); ++i) {
+            T w = cur.weight + all[i].weight;
+            if (before + w <= limit) {
+                cur.mean += (all[i].mean - cur.mean) * all[i].weight / w;
+                cur.weight = w;
+            } else {
+                centroids_.push_back(cur);
+                before += cur.weight;
+                limit = q_limit(before / total) * total;
+                cur = all[i];
+            }
+        }
+        centroids_.push_back(cur);
+    }
+
+    // Mean-sorted centroids and buffered values as one mean-sorted list of
+    // centroids; sorts values.
+    static std::vector<Centroid> with_values(const std::vector<Centroid>& centroids, std::vector<T>& values) {
+        std::sort(values.begin(), values.end());
+        std::vector<Centroid> all;
+        all.reserve(centroids.size() + values.size());
+        std::size_t i = 0;
+        for (T v : values) {
+            while (i < centroids.size() && centroids[i].mean < v) {
+                all.push_back(centroids[i++]);
+            }
+            all.push_back({v, T{1}});
+        }
+        all.insert(all.end(), centroids.begin() + static_cast<std::ptrdiff_t>(i), centroids.end());
+        return all;
+    }
+
+    void flush() const {
+        if (buffer_.empty()) {
+            return;
+        }
+        std::vector<Centroid> all = with_values(centroids_, buffer_);
+        buffer_.clear();
+        compress(all);
+    }
+
+    // The piecewise-linear CDF through (0, min), (centre rank of each
+    // centroid, its mean) and (n, max), as rank -> value.
+    T value_at_rank(T rank) const {
+        const auto& c = centroids_;
+        T total = static_cast<T>(n_);
+        T prev_rank = T{0};
+        T prev_value = min_;
+        T before = T{0};
+        for (const auto& ci : c) {
+            T centre = before + ci.weight / 2;
+            if (rank <= centre) {
+                return interpolate(prev_rank, prev_value, centre, ci.mean, rank);
+            }
+            prev_rank = centre;
+            prev_value = ci.mean;
+            before += ci.weight;
+        }
+        return interpolate(prev_rank, prev_value, total, max_, rank);
+    }
+
+    static T interpolate(T r0, T v0, T r1, T v1, T r) {
+        if (r1 <= r0) {
+            return v1;
+        }
+        return v0 + (v1 - v0) * ((r - r0) / (r1 - r0));
+    }
+
+public:
+    using value_type = T;
+
+    // Larger compression keeps more centroids: about `compression` of them
+    // at most, and proportionally smaller rank error.
+    explicit TDigest(T compression = T{100}) : delta_(std::max(compression, T{10})) {}
+
+    void push(T x) {
+        if (std::isnan(x)) {
+            return;
+        }
+        ++n_;
+        min_ = std::min(min_, x);
+        max_ = std::max(max_, x);
+        buffer_.push_back(x);
+        if (buffer_.size() >= buffer_capacity()) {
+            flush();
+        }
+    }
+
+    void push(std::span<const T> data) {
+        std::size_t cap = buffer_capacity();
+        buffer_.reserve(cap);
+        for (T x : data) {
+            if (std::isnan(x)) {
+                continue;
+            }
+            ++n_;
+            min_ = std::min(min_, x);
+            max_ = std::max(max_, x);
+            buffer_.push_back(x);
+            if (buffer_.size() >= cap) {
+                flush();
+            }
+        }
+    }
+
+    // Folds other in; the result keeps this digest's compression. other is
+    // only read, its buffered values through a sorted local copy, so one
+    // digest may be merged into several others concurrently.
+    void merge(const TDigest& other) {
+        if (other.n_ == 0) {
+            return;
+        }
+        flush();
+        std::vector<T> values = other.buffer_;
+        std::vector<Centroid> theirs = with_values(other.centroids_, values);
+        std::vector<Centroid> all(centroids_.size() + theirs.size());
+        std::merge(centroids_.begin(), centroids_.end(), theirs.begin(), theirs.end(), all.begin(),
+                   [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+        n_ += other.n_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        compress(all);
+    }
+
+    void clear() { *this = TDigest(delta_); }
+
+    std::uint64_t count() const { return n_; }
+    T compression() const { return delta_; }
+    T min() const { return min_; }
+    T max() const { return max_; }
+
+    std::span<const Centroid> centroids() const {
+        flush();
+        return centroids_;
+    }
+
+    // Estimated q-quantile; NaN for an empty digest or q outside [0, 1].
+    // q = 0 and q = 1 give the exact min and max.
+    T quantile(double q) const {
+        if (n_ == 0 || !(q >= 0.0 && q <= 1.0)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        flush();
+        return value_at_rank(static_cast<T>(q) * static_cast<T>(n_));
+    }
+
+    void quantiles(std::span<const double> qs, std::span<T> out) const {
+        std::size_t m = std::min(qs.size(), out.size());
+        for (std::size_t i = 0; i < m; ++i) {
+            out[i] = quantile(qs[i]);
+        }
+    }
+
+    // Estimated fraction of values <= x, the inverse of quantile().
+    T cdf(T x) const {
+        if (n_ == 0 || std::isnan(x)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (x < min_) {
+            return T{0};
+        }
+        if (x >= max_) {
+            return T{1};
+        }
+        flush();
+        T total = static_cast<T>(n_);
+        T prev_rank = T{0};
+        T prev_value = min_;
+        T before = T{0};
+        for (const auto& c : centroids_) {
+            T centre = before + c.weight / 2;
+            if (x < c.mean) {
+                return interpolate(prev_value, prev_rank, c.mean, centre, x) / total;
+            }
+            prev_rank = centre;
+            prev_value = c.mean;
+            before += c.weight;
+        }
+        return interpolate(prev_value, prev_rank, max_, total, x) / total;
+    }
+
+    // Half the width, in q, that the scale function allows a centroid
+    // around q: pi sqrt(q (1 - q)) / compression, floored at the size of
+    // the outermost centroids. Interpolating inside one centroid cannot be
+    // further off than this, so it bounds the rank error of quantile() and
+    // cdf() as long as centroids do not overlap; after many merges of
+    // digests built from very different data they can, and the bound
+    // becomes an estimate. KllSketch gives a bound that always holds.
+    T rank_error(double q) const {
+        T pi = std::numbers::pi_v<T>;
+        T qt = std::clamp(static_cast<T>(q), T{0}, T{1});
+        return std::max(pi * std::sqrt(qt * (1 - qt)) / delta_, pi * pi / (delta_ * delta_));
+    }
+
+    std::vector<std::byte> serialize() const {
+        flush();
+        detail::ByteWriter w;
+        w.put(tag);
+        w.put(static_cast<std::uint32_t>(sizeof(T)));
+        w.put(delta_);
+        w.put(n_);
+        w.put(min_);
+        w.put(max_);
+        w.put_array(std::span<const Centroid>(centroids_));
+        return w.take();
+    }
+
+    // The digest serialize() wrote, or nullopt for bytes that are
+    // truncated, from a different value type or internally inconsistent.
+    static std::optional<TDigest> deserialize(std::span<const std::byte> bytes) {
+        detail::ByteReader r(bytes);
+        if (r.get<std::uint32_t>() != tag || r.get<std::uint32_t>() != sizeof(T)) {
+            return std::nullopt;
+        }
+        T delta = r.get<T>();
+        if (!(delta >= T{10} && delta <= T{1e6})) {
+            return std::nullopt;
+        }
+        TDigest d(delta);
+        d.n_ = r.get<std::uint64_t>();
+        d.min_ = r.get<T>();
+        d.max_ = r.get<T>();
+        d.centroids_ = r.get_array<Centroid>(static_cast<std::size_t>(2 * delta) + 16);
+        if (!r.done()) {
+            return std::nullopt;
+        }
+        T total = T{0};
+        for (std::size_t i = 0; i < d.centroids_.size(); ++i) {
+            const auto& c = d.centroids_[i];
+            if (!(c.weight > T{0}) || std::isnan(c.mean) || (i > 0 && c.mean < d.centroids_[i - 1].mean)) {
+                return std::nullopt;
+            }
+            total += c.weight;
+        }
+        // Weights are whole counts, so the sum is exact except for float
+        // digests past 2^24 values.
+        T n = static_cast<T>(d.n_);
+        if (!(std::abs(total - n) <= n * T{1e-3}) || (d.n_ > 0 && !(d.min_ <= d.max_))) {
+            return std::nullopt;
+        }
+        return d;
+    }
+};
+
+}
+
+#endif
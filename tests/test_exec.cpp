@@ -0,0 +1,90 @@
+#include <math/exec/parallel.hpp>
+#include <math/exec/policy.hpp>
+#include <math/exec/thread_pool.hpp>
+#include "test_framework.hpp"
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+using namespace math;
+using namespace math::test;
+
+TEST(thread_pool_runs_tasks) {
+    exec::ThreadPool pool(4);
+    std::atomic<int> counter{0};
+    exec::TaskGroup group(pool);
+    for (int i = 0; i < 100; ++i) {
+        group.run([&counter] { counter.fetch_add(1); });
+    }
+    group.wait();
+    assert_eq(counter.load(), 100);
+}
+
+TEST(parallel_for_covers_range) {
+    exec::ThreadPool pool(3);
+    std::vector<int> hits(10007, 0);
+    exec::parallel_for(exec::par.on(pool).with_grain(64), 0, hits.size(), 1,
+                       [&hits](std::size_t b, std::size_t e) {
+                           for (std::size_t i = b; i < e; ++i) hits[i] += 1;
+                       });
+    for (int h : hits) {
+        assert_eq(h, 1);
+    }
+}
+
+TEST(parallel_for_nested) {
+    exec::ThreadPool pool(2);
+    std::atomic<long> total{0};
+    exec::parallel_for(exec::par.on(pool).with_grain(1), 0, 8, 1, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) {
+            exec::parallel_for(exec::par.on(pool).with_grain(10), 0, 100, 1, [&](std::size_t b2, std::size_t e2) {
+                total.fetch_add(static_cast<long>(e2 - b2));
+            });
+        }
+    });
+    assert_eq(total.load(), 800L);
+}
+
+TEST(parallel_reduce_sum) {
+    std::vector<double> data(100000);
+    std::iota(data.begin(), data.end(), 1.0);
+    double expected = 100000.0 * 100001.0 / 2.0;
+    auto f = [&data](std::size_t i) { return data[i]; };
+    assert_near(exec::transform_sum<double>(exec::seq, data.size(), f), expected, 1e-6);
+    assert_near(exec::transform_sum<double>(exec::par.with_grain(1000), data.size(), f), expected, 1e-6);
+    assert_near(exec::transform_sum<double>(exec::par_simd.with_grain(1000), data.size(), f), expected, 1e-6);
+}
+
+TEST(deterministic_sum_independent_of_threads) {
+    std::vector<double> data(300001);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = std::sin(static_cast<double>(i)) * 1e8 + 1e-3 * static_cast<double>(i % 7);
+    }
+    auto f = [&data](std::size_t i) { return data[i]; };
+    double reference = exec::deterministic_sum<double>(0, data.size(), f);
+
+    for (std::size_t threads : {1, 2, 3, 7}) {
+        exec::ThreadPool pool(threads);
+        for (std::size_t grain : {1, 5, 64}) {
+            double result = exec::transform_sum<double>(exec::deterministic.on(pool).with_grain(grain),
+                                                        data.size(), f);
+            assert_true(result == reference);
+        }
+    }
+}
+
+TEST(parallel_exception_propagates) {
+    exec::ThreadPool pool(2);
+    bool caught = false;
+    try {
+        exec::parallel_for(exec::par.on(pool).with_grain(1), 0, 16, 1, [](std::size_t b, std::size_t) {
+            if (b == 7) throw std::runtime_error("boom");
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    assert_true(caught);
+}
+
+RUN_ALL_TESTS()
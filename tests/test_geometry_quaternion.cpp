@@ -0,0 +1,60 @@
+#include <math/geometry/quaternion.hpp>
+#include "test_framework.hpp"
+#include <cmath>
+#include <numbers>
+
+using namespace math;
+using namespace math::test;
+using namespace math::geometry;
+
+TEST(quaternion_rotate_axis_angle) {
+    auto q = Quaternion<double>::from_axis_angle(Vec3<double>(0.0, 0.0, 1.0), std::numbers::pi / 2);
+    auto v = q.rotate(Vec3<double>(1.0, 0.0, 0.0));
+    assert_near(v[0], 0.0, 1e-12);
+    assert_near(v[1], 1.0, 1e-12);
+    assert_near(v[2], 0.0, 1e-12);
+}
+
+TEST(quaternion_matrix_roundtrip) {
+    auto q = Quaternion<double>::from_axis_angle(Vec3<double>(1.0, 2.0, -0.5), 2.3);
+    auto m = q.to_matrix3();
+    Vec3<double> p(0.3, -1.2, 4.0);
+    auto a = q.rotate(p);
+    auto b = m * p;
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(a[i], b[i], 1e-12);
+    }
+
+    auto r = Quaternion<double>::from_matrix(m);
+    assert_near(std::abs(dot(q, r)), 1.0, 1e-12);
+}
+
+TEST(quaternion_composition_and_inverse) {
+    auto a = Quaternion<double>::from_axis_angle(Vec3<double>(0.0, 1.0, 0.0), 0.7);
+    auto b = Quaternion<double>::from_axis_angle(Vec3<double>(1.0, 0.0, 0.0), -1.1);
+    Vec3<double> p(1.0, 2.0, 3.0);
+    auto composed = (a * b).rotate(p);
+    auto sequential = a.rotate(b.rotate(p));
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(composed[i], sequential[i], 1e-12);
+    }
+    auto back = (a * a.inverse()).rotate(p);
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(back[i], p[i], 1e-12);
+    }
+}
+
+TEST(quaternion_slerp) {
+    Vec3<double> axis(0.0, 0.0, 1.0);
+    auto a = Quaternion<double>::identity();
+    auto b = Quaternion<double>::from_axis_angle(axis, 1.0);
+    auto half = slerp(a, b, 0.5);
+    auto expected = Quaternion<double>::from_axis_angle(axis, 0.5);
+    assert_near(dot(half, expected), 1.0, 1e-12);
+
+    auto n = nlerp(a, b, 0.5);
+    assert_near(n.norm(), 1.0, 1e-12);
+    assert_near(dot(n, expected), 1.0, 1e-12);
+}
+
+RUN_ALL_TESTS()
@@ -0,0 +1,82 @@
+#include <math/geometry/transform.hpp>
+#include <span>
+#include <vector>
+#include "test_framework.hpp"
+
+using namespace math;
+using namespace math::test;
+using namespace math::geometry;
+
+TEST(transform_compose_matches_matrix) {
+    Transform<double> a(Vec3<double>(1.0, 2.0, 3.0),
+                        Quaternion<double>::from_axis_angle(Vec3<double>(0.0, 1.0, 0.0), 0.4), 2.0);
+    Transform<double> b(Vec3<double>(-1.0, 0.5, 0.0),
+                        Quaternion<double>::from_axis_angle(Vec3<double>(1.0, 1.0, 0.0), 1.3), 0.5);
+
+    auto composed = (a * b).to_matrix4();
+    auto product = a.to_matrix4() * b.to_matrix4();
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            assert_near(composed(i, j), product(i, j), 1e-12);
+        }
+    }
+}
+
+TEST(transform_inverse) {
+    Transform<double> t(Vec3<double>(4.0, -2.0, 1.0),
+                        Quaternion<double>::from_axis_angle(Vec3<double>(0.2, 0.3, 1.0), 2.1), 3.0);
+    Vec3<double> p(0.5, 1.5, -2.5);
+    auto back = t.inverse().transform_point(t.transform_point(p));
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(back[i], p[i], 1e-12);
+    }
+}
+
+TEST(affine_inverse) {
+    auto a = Affine3<double>::from_trs(Vec3<double>(1.0, 2.0, 3.0),
+                                       Quaternion<double>::from_axis_angle(Vec3<double>(1.0, 0.0, 0.0), 0.9),
+                                       Vec3<double>(1.0, 2.0, 0.5));
+    Vec3<double> p(-1.0, 0.25, 7.0);
+    auto back = a.inverse().transform_point(a.transform_point(p));
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(back[i], p[i], 1e-12);
+    }
+
+    auto rigid = Affine3<double>::from_trs(Vec3<double>(1.0, 2.0, 3.0),
+                                           Quaternion<double>::from_axis_angle(Vec3<double>(0.0, 0.0, 1.0), 0.3),
+                                           Vec3<double>(1.0, 1.0, 1.0));
+    auto identity = (rigid * rigid.rigid_inverse()).to_matrix4();
+    auto expected = Matrix<double, 4, 4>::identity();
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            assert_near(identity(i, j), expected(i, j), 1e-12);
+        }
+    }
+}
+
+TEST(transform_batch_to_matrices) {
+    std::vector<Transform<double>> transforms(3);
+    transforms[1].translation = Vec3<double>(1.0, 0.0, 0.0);
+    transforms[2].scale = 2.0;
+    std::vector<Matrix<double, 4, 4>> out(3);
+    to_matrices(std::span<const Transform<double>>(transforms), std::span<Matrix<double, 4, 4>>(out));
+    assert_near(out[1](0, 3), 1.0, 1e-12);
+    assert_near(out[2](1, 1), 2.0, 1e-12);
+}
+
+TEST(transform_hierarchy) {
+    std::vector<Transform<double>> local(3);
+    local[0].translation = Vec3<double>(1.0, 0.0, 0.0);
+    local[1].translation = Vec3<double>(0.0, 1.0, 0.0);
+    local[2].translation = Vec3<double>(0.0, 0.0, 1.0);
+    std::vector<std::size_t> parent = {0, 0, 1};
+    std::vector<Transform<double>> world(3);
+    compose_hierarchy(std::span<const Transform<double>>(local),
+                      std::span<const std::size_t>(parent),
+                      std::span<Transform<double>>(world));
+    assert_near(world[2].translation[0], 1.0, 1e-12);
+    assert_near(world[2].translation[1], 1.0, 1e-12);
+    assert_near(world[2].translation[2], 1.0, 1e-12);
+}
+
+RUN_ALL_TESTS()
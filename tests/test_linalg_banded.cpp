@@ -0,0 +1,131 @@
+#include <math/linalg/banded.hpp>
+#include <math/linalg/packed.hpp>
+#include "test_framework.hpp"
+
+using namespace math;
+using namespace math::test;
+using namespace math::linalg;
+
+namespace {
+
+TridiagonalMatrix<double> poisson_1d(std::size_t n) {
+    TridiagonalMatrix<double> A(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        A.diag()[i] = 2.0 + 0.1 * static_cast<double>(i % 3);
+        if (i + 1 < n) {
+            A.lower()[i] = -1.0;
+            A.upper()[i] = -0.5;
+        }
+    }
+    return A;
+}
+
+std::vector<double> ramp(std::size_t n) {
+    std::vector<double> b(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        b[i] = 1.0 + 0.25 * static_cast<double>(i);
+    }
+    return b;
+}
+
+}
+
+TEST(thomas_solve) {
+    auto A = poisson_1d(17);
+    auto b = ramp(17);
+    auto x = thomas_solve(A, std::span<const double>(b));
+    assert_true(x.has_value());
+    auto Ax = A * std::span<const double>(*x);
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        assert_near(Ax[i], b[i], 1e-12);
+    }
+}
+
+TEST(cyclic_reduction_matches_thomas) {
+    auto A = poisson_1d(23);
+    auto b = ramp(23);
+    auto x_thomas = thomas_solve(A, std::span<const double>(b));
+    auto x_cr = cyclic_reduction_solve(A, std::span<const double>(b));
+    assert_true(x_cr.has_value());
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        assert_near((*x_cr)[i], (*x_thomas)[i], 1e-12);
+    }
+}
+
+TEST(cyclic_reduction_batch) {
+    constexpr std::size_t n = 9;
+    constexpr std::size_t m = 5;
+    TridiagonalBatch<double> batch(n, m);
+    std::vector<double> rhs(n * m);
+    for (std::size_t s = 0; s < m; ++s) {
+        for (std::size_t i = 0; i < n; ++i) {
+            batch.diag_at(i, s) = 4.0 + static_cast<double>(s);
+            batch.lower_at(i, s) = -1.0;
+            batch.upper_at(i, s) = -1.0;
+            rhs[i * m + s] = static_cast<double>(i + s);
+        }
+    }
+    std::vector<double> x = rhs;
+    assert_true(cyclic_reduction_solve(batch, std::span<double>(x)));
+
+    for (std::size_t s = 0; s < m; ++s) {
+        for (std::size_t i = 0; i < n; ++i) {
+            double r = batch.diag_at(i, s) * x[i * m + s];
+            if (i > 0) r += batch.lower_at(i, s) * x[(i - 1) * m + s];
+            if (i + 1 < n) r += batch.upper_at(i, s) * x[(i + 1) * m + s];
+            assert_near(r, rhs[i * m + s], 1e-12);
+        }
+    }
+}
+
+TEST(banded_lu_solve) {
+    constexpr std::size_t n = 12;
+    BandedMatrix<double, 2, 1> A(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = (i > 2 ? i - 2 : 0); j <= std::min(n - 1, i + 1); ++j) {
+            A(i, j) = (i == j) ? 0.5 : 1.0 + 0.1 * static_cast<double>(i + 2 * j);
+        }
+    }
+    auto b = ramp(n);
+    auto x = solve(A, std::span<const double>(b));
+    assert_true(x.has_value());
+    auto Ax = A * std::span<const double>(*x);
+    for (std::size_t i = 0; i < n; ++i) {
+        assert_near(Ax[i], b[i], 1e-10);
+    }
+}
+
+TEST(banded_cholesky_solve) {
+    constexpr std::size_t n = 10;
+    BandedMatrix<double, 2, 2> A(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        A(i, i) = 6.0;
+        if (i + 1 < n) { A(i, i + 1) = -2.0; A(i + 1, i) = -2.0; }
+        if (i + 2 < n) { A(i, i + 2) = 0.5; A(i + 2, i) = 0.5; }
+    }
+    auto b = ramp(n);
+    auto x = solve_cholesky(A, std::span<const double>(b));
+    assert_true(x.has_value());
+    auto Ax = A * std::span<const double>(*x);
+    for (std::size_t i = 0; i < n; ++i) {
+        assert_near(Ax[i], b[i], 1e-12);
+    }
+}
+
+TEST(packed_cholesky_solve) {
+    PackedSymmetric<double> A(3);
+    A(0, 0) = 4.0;
+    A(1, 0) = 12.0; A(1, 1) = 37.0;
+    A(2, 0) = -16.0; A(2, 1) = -43.0; A(2, 2) = 98.0;
+    assert_near(A(0, 2), -16.0, 1e-12);
+
+    std::vector<double> b = {1.0, 2.0, 3.0};
+    auto x = solve_cholesky(A, std::span<const double>(b));
+    assert_true(x.has_value());
+    auto Ax = A * std::span<const double>(*x);
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(Ax[i], b[i], 1e-9);
+    }
+}
+
+RUN_ALL_TESTS()
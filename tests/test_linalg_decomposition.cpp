@@ -67,4 +67,18 @@ TEST(cholesky_decomposition_3x3) {
     }
 }
 
+TEST(lu_decomposition_parallel_matches_sequential) {
+    Matrix<double, 48, 48> A;
+    for (std::size_t i = 0; i < 48; ++i) {
+        for (std::size_t j = 0; j < 48; ++j) {
+            A(i, j) = std::sin(static_cast<double>(i * 48 + j)) + (i == j ? 4.0 : 0.0);
+        }
+    }
+    auto seq = lu_decompose(A);
+    auto par = lu_decompose(exec::par.with_grain(4), A);
+    assert_true(!par.singular);
+    assert_true(seq.U == par.U);
+    assert_true(seq.L == par.L);
+}
+
 RUN_ALL_TESTS()
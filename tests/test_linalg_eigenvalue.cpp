@@ -45,6 +45,20 @@ TEST(qr_algorithm_symmetric) {
     }
 }
 
+TEST(qr_algorithm_parallel) {
+    Matrix<double, 3, 3> A;
+    A(0, 0) = 4.0; A(0, 1) = 1.0; A(0, 2) = 0.0;
+    A(1, 0) = 1.0; A(1, 1) = 3.0; A(1, 2) = 1.0;
+    A(2, 0) = 0.0; A(2, 1) = 1.0; A(2, 2) = 2.0;
+    
+    auto seq = qr_algorithm(A);
+    auto par = qr_algorithm(exec::par.with_grain(1), A);
+    assert_true(par.converged);
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(par.eigenvalues[i], seq.eigenvalues[i], 1e-10);
+    }
+}
+
 TEST(rayleigh_quotient) {
     Matrix<double, 3, 3> A;
     A(0, 0) = 2.0; A(0, 1) = 0.0; A(0, 2) = 0.0;
@@ -1,4 +1,5 @@
 #include <math/linalg/norm.hpp>
+#include <vector>
 #include "test_framework.hpp"
 
 using namespace math;
@@ -20,6 +21,42 @@ TEST(linf_norm_vector) {
     assert_near(linf_norm(v), 5.0, 1e-10);
 }
 
+TEST(l2_norm_no_overflow) {
+    Vec3<double> v(3e200, 4e200, 0.0);
+    assert_near(l2_norm(v) / 5e200, 1.0, 1e-14);
+
+    Vec2<double> tiny(3e-200, 4e-200);
+    assert_near(l2_norm(tiny) / 5e-200, 1.0, 1e-14);
+}
+
+TEST(lp_norm_integer_power) {
+    Vec3<double> v(1.0, -2.0, 3.0);
+    assert_near((lp_norm<double, 3, 1>(v)), 6.0, 1e-12);
+    assert_near((lp_norm<double, 3, 2>(v)), std::sqrt(14.0), 1e-12);
+    assert_near((lp_norm<double, 3, 3>(v)), std::cbrt(36.0), 1e-12);
+}
+
+TEST(fused_norms) {
+    std::vector<double> data(37);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = (i % 2 == 0 ? 1.0 : -1.0) * static_cast<double>(i);
+    }
+    auto s = norms(std::span<const double>(data));
+    double l1 = 0.0, sq = 0.0;
+    for (double x : data) {
+        l1 += std::abs(x);
+        sq += x * x;
+    }
+    assert_near(s.l1, l1, 1e-10);
+    assert_near(s.l2, std::sqrt(sq), 1e-10);
+    assert_near(s.linf, 36.0, 1e-12);
+    assert_eq(s.non_finite, std::size_t{0});
+
+    data[5] = std::numeric_limits<double>::infinity();
+    data[7] = std::numeric_limits<double>::quiet_NaN();
+    assert_eq(norms(std::span<const double>(data)).non_finite, std::size_t{2});
+}
+
 TEST(frobenius_norm_matrix) {
     Matrix<double, 2, 2> m;
     m(0, 0) = 1.0; m(0, 1) = 2.0;
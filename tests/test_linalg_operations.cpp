@@ -1,4 +1,5 @@
 #include <math/linalg/operations.hpp>
+#include <cmath>
 #include "test_framework.hpp"
 
 using namespace math;
@@ -45,4 +46,121 @@ TEST(inverse_3x3) {
     assert_near(identity(2, 2), 1.0, 1e-10);
 }
 
+TEST(determinant_4x4) {
+    Matrix<double, 4, 4> m;
+    m(0, 0) = 4.0; m(0, 1) = 3.0; m(0, 2) = 2.0; m(0, 3) = 1.0;
+    m(1, 0) = 0.0; m(1, 1) = 1.0; m(1, 2) = -1.0; m(1, 3) = 2.0;
+    m(2, 0) = 1.0; m(2, 1) = 0.0; m(2, 2) = 3.0; m(2, 3) = 0.0;
+    m(3, 0) = 2.0; m(3, 1) = 1.0; m(3, 2) = 0.0; m(3, 3) = 1.0;
+    assert_near(determinant(m), 18.0, 1e-10);
+}
+
+TEST(inverse_4x4) {
+    Matrix<double, 4, 4> m;
+    m(0, 0) = 4.0; m(0, 1) = 3.0; m(0, 2) = 2.0; m(0, 3) = 1.0;
+    m(1, 0) = 0.0; m(1, 1) = 1.0; m(1, 2) = -1.0; m(1, 3) = 2.0;
+    m(2, 0) = 1.0; m(2, 1) = 0.0; m(2, 2) = 3.0; m(2, 3) = 0.0;
+    m(3, 0) = 2.0; m(3, 1) = 1.0; m(3, 2) = 0.0; m(3, 3) = 1.0;
+    auto identity = m * inverse(m);
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            assert_near(identity(i, j), i == j ? 1.0 : 0.0, 1e-12);
+        }
+    }
+}
+
+TEST(inverse_affine_and_rigid) {
+    Matrix<double, 4, 4> rigid = Matrix<double, 4, 4>::identity();
+    double c = std::cos(0.3), s = std::sin(0.3);
+    rigid(0, 0) = c; rigid(0, 1) = -s;
+    rigid(1, 0) = s; rigid(1, 1) = c;
+    rigid(0, 3) = 1.0; rigid(1, 3) = 2.0; rigid(2, 3) = 3.0;
+
+    auto a = rigid * inverse_rigid(rigid);
+    auto scaled = rigid;
+    scaled(2, 2) = 4.0;
+    auto b = scaled * inverse_affine(scaled);
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            assert_near(a(i, j), i == j ? 1.0 : 0.0, 1e-12);
+            assert_near(b(i, j), i == j ? 1.0 : 0.0, 1e-12);
+        }
+    }
+}
+
+TEST(small_inverse_5x5) {
+    Matrix<double, 5, 5> m;
+    for (std::size_t i = 0; i < 5; ++i) {
+        for (std::size_t j = 0; j < 5; ++j) {
+            m(i, j) = 1.0 / static_cast<double>(i + j + 1) + (i == j ? 1.0 : 0.0);
+        }
+    }
+    auto result = small_inverse(m);
+    assert_true(!result.singular);
+    assert_near(result.determinant, determinant(m), 1e-10);
+    auto identity = m * result.inverse;
+    for (std::size_t i = 0; i < 5; ++i) {
+        for (std::size_t j = 0; j < 5; ++j) {
+            assert_near(identity(i, j), i == j ? 1.0 : 0.0, 1e-12);
+        }
+    }
+}
+
+TEST(small_inverse_singular) {
+    Matrix<double, 6, 6> m;
+    for (std::size_t i = 0; i < 6; ++i) {
+        for (std::size_t j = 0; j < 6; ++j) {
+            m(i, j) = static_cast<double>(i + j);
+        }
+    }
+    assert_true(small_inverse(m).singular);
+
+    Matrix<double, 4, 4> scaled = Matrix<double, 4, 4>::identity() * 1e-6;
+    assert_true(!small_inverse(scaled).singular);
+    scaled(3, 3) = 0.0;
+    assert_true(small_inverse(scaled).singular);
+}
+
+TEST(small_inverse_constexpr) {
+    constexpr auto result = [] {
+        Matrix<double, 3, 3> m = Matrix<double, 3, 3>::identity() * 2.0;
+        return small_inverse(m);
+    }();
+    static_assert(!result.singular);
+    static_assert(result.inverse(1, 1) == 0.5);
+    assert_near(result.determinant, 8.0, 1e-12);
+}
+
+TEST(vector_dot_policies) {
+    Vector<double, 37> a, b;
+    for (std::size_t i = 0; i < 37; ++i) {
+        a[i] = 0.1 * static_cast<double>(i) - 1.0;
+        b[i] = 1.0 / static_cast<double>(i + 1);
+    }
+    double plain = dot(a, b);
+    assert_true(dot(exec::seq, a, b) == plain);
+    assert_near(dot(exec::par_simd, a, b), plain, 1e-12);
+
+    auto term = [&a, &b](std::size_t i) { return a[i] * b[i]; };
+    assert_true(dot(exec::deterministic, a, b) == exec::deterministic_sum<double>(0, 37, term));
+}
+
+TEST(multiply_parallel) {
+    Matrix<double, 33, 17> a;
+    Matrix<double, 17, 29> b;
+    for (std::size_t i = 0; i < 33; ++i)
+        for (std::size_t j = 0; j < 17; ++j)
+            a(i, j) = static_cast<double>(i) - 0.5 * static_cast<double>(j);
+    for (std::size_t i = 0; i < 17; ++i)
+        for (std::size_t j = 0; j < 29; ++j)
+            b(i, j) = 0.25 * static_cast<double>(i * j) + 1.0;
+    auto expected = a * b;
+    auto result = multiply(exec::par.with_grain(2), a, b);
+    for (std::size_t i = 0; i < 33; ++i) {
+        for (std::size_t j = 0; j < 29; ++j) {
+            assert_near(result(i, j), expected(i, j), 1e-9);
+        }
+    }
+}
+
 RUN_ALL_TESTS()
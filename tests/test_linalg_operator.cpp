@@ -0,0 +1,180 @@
+#include <math/linalg/operator.hpp>
+#include <math/linalg/krylov.hpp>
+#include <math/linalg/eigenvalue.hpp>
+#include "test_framework.hpp"
+#include <cmath>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+
+using namespace math;
+using namespace math::test;
+using namespace math::linalg;
+
+namespace {
+
+template<typename M>
+concept BindsOperator = requires(M&& m) { make_operator(std::forward<M>(m)); };
+
+template<typename M>
+concept BindsGram = requires(M&& m) { gram(std::forward<M>(m)); };
+
+}
+
+TEST(operator_concepts) {
+    assert_true(concepts::LinearOperator<MatrixOperator<double, 3>>);
+    assert_true(concepts::DiagonalOperator<MatrixOperator<double, 3>>);
+    assert_true(concepts::LinearOperator<NormalOperator<MatrixOperator<double, 3>>>);
+    assert_true(!concepts::DiagonalOperator<NormalOperator<MatrixOperator<double, 3>>>);
+    assert_true(!concepts::LinearOperator<Matrix<double, 3, 3>>);
+}
+
+TEST(operator_rejects_temporaries) {
+    // The wrappers keep a pointer to the matrix, so a temporary would dangle.
+    assert_true(BindsOperator<Matrix<double, 3, 3>&>);
+    assert_true(BindsOperator<const Matrix<double, 3, 3>&>);
+    assert_true(!BindsOperator<Matrix<double, 3, 3>>);
+    assert_true(BindsGram<Matrix<double, 3, 2>&>);
+    assert_true(!BindsGram<Matrix<double, 3, 2>>);
+    assert_true(!std::is_constructible_v<MatrixOperator<double, 3>, Matrix<double, 3, 3>>);
+    assert_true(std::is_constructible_v<MatrixOperator<double, 3>, Matrix<double, 3, 3>&>);
+}
+
+TEST(matrix_operator_transpose) {
+    Matrix<double, 2, 2> A;
+    A(0, 0) = 1.0; A(0, 1) = 2.0;
+    A(1, 0) = 3.0; A(1, 1) = 4.0;
+    auto op = make_operator(A);
+    Vec2<double> x(1.0, 1.0);
+    auto y = op.apply_transpose(x);
+    assert_near(y[0], 4.0, 1e-12);
+    assert_near(y[1], 6.0, 1e-12);
+}
+
+TEST(gram_operator_matches_dense) {
+    Matrix<double, 3, 2> A;
+    A(0, 0) = 1.0; A(0, 1) = 2.0;
+    A(1, 0) = 3.0; A(1, 1) = 4.0;
+    A(2, 0) = 5.0; A(2, 1) = 6.0;
+    Vec2<double> x(0.5, -1.0);
+    auto expected = (A.transpose() * A) * x;
+    auto y = gram(A).apply(x);
+    assert_near(y[0], expected[0], 1e-12);
+    assert_near(y[1], expected[1], 1e-12);
+}
+
+TEST(kronecker_operator_matches_dense) {
+    Matrix<double, 2, 2> A;
+    A(0, 0) = 1.0; A(0, 1) = 2.0;
+    A(1, 0) = 3.0; A(1, 1) = 4.0;
+    Matrix<double, 2, 2> B;
+    B(0, 0) = 0.0; B(0, 1) = 5.0;
+    B(1, 0) = 6.0; B(1, 1) = 7.0;
+
+    Matrix<double, 4, 4> K;
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 2; ++j)
+            for (std::size_t k = 0; k < 2; ++k)
+                for (std::size_t l = 0; l < 2; ++l)
+                    K(i * 2 + k, j * 2 + l) = A(i, j) * B(k, l);
+
+    auto op = kronecker(make_operator(A), make_operator(B));
+    Vec4<double> x(1.0, -2.0, 0.5, 3.0);
+    auto y = op.apply(x);
+    auto yt = op.apply_transpose(x);
+    auto expected = K * x;
+    auto expected_t = K.transpose() * x;
+    auto d = op.diagonal();
+    for (std::size_t i = 0; i < 4; ++i) {
+        assert_near(y[i], expected[i], 1e-12);
+        assert_near(yt[i], expected_t[i], 1e-12);
+        assert_near(d[i], K(i, i), 1e-12);
+    }
+}
+
+TEST(conjugate_gradient_spd) {
+    Matrix<double, 3, 3> A;
+    A(0, 0) = 4.0; A(0, 1) = 1.0; A(0, 2) = 0.0;
+    A(1, 0) = 1.0; A(1, 1) = 3.0; A(1, 2) = 1.0;
+    A(2, 0) = 0.0; A(2, 1) = 1.0; A(2, 2) = 2.0;
+    Vec3<double> b(1.0, 2.0, 3.0);
+
+    auto result = conjugate_gradient(make_operator(A), b);
+    assert_true(result.converged);
+    auto Ax = A * result.x;
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(Ax[i], b[i], 1e-8);
+    }
+}
+
+TEST(power_iteration_operator) {
+    Matrix<double, 3, 3> A;
+    A(0, 0) = 2.0; A(0, 1) = 1.0; A(0, 2) = 0.0;
+    A(1, 0) = 1.0; A(1, 1) = 2.0; A(1, 2) = 1.0;
+    A(2, 0) = 0.0; A(2, 1) = 1.0; A(2, 2) = 2.0;
+
+    auto [lambda, v] = power_iteration(normal(make_operator(A)));
+    auto AtAv = (A.transpose() * A) * v;
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(AtAv[i], lambda * v[i], 1e-6);
+    }
+    double largest = 2.0 + std::sqrt(2.0);
+    assert_near(lambda, largest * largest, 1e-6);
+}
+
+TEST(inverse_iteration_operator) {
+    Matrix<double, 3, 3> A;
+    A(0, 0) = 2.0; A(0, 1) = 0.0; A(0, 2) = 0.0;
+    A(1, 0) = 0.0; A(1, 1) = 3.0; A(1, 2) = 0.0;
+    A(2, 0) = 0.0; A(2, 1) = 0.0; A(2, 2) = 5.0;
+
+    auto [lambda, v] = inverse_iteration(make_operator(A), 2.8);
+    assert_near(lambda, 3.0, 1e-8);
+    assert_near(std::abs(v[1]), 1.0, 1e-6);
+}
+
+TEST(minres_symmetric_indefinite) {
+    // Eigenvalues of opposite sign: CG breaks down, MINRES does not.
+    Matrix<double, 3, 3> A;
+    A(0, 0) = 1.0; A(0, 1) = 2.0; A(0, 2) = 0.0;
+    A(1, 0) = 2.0; A(1, 1) = -3.0; A(1, 2) = 1.0;
+    A(2, 0) = 0.0; A(2, 1) = 1.0; A(2, 2) = 0.5;
+    Vec3<double> b(1.0, -1.0, 2.0);
+
+    auto result = minres(make_operator(A), b);
+    assert_true(result.converged);
+    assert_true(result.iterations <= 4);
+    auto Ax = A * result.x;
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert_near(Ax[i], b[i], 1e-9);
+    }
+}
+
+TEST(inverse_iteration_operator_near_eigenvalue) {
+    // Shifts within 1e-9 of 2 + sqrt(2), from both sides: (A - sigma I) is
+    // nearly singular, which CGNR could not solve to the tolerance.
+    Matrix<double, 4, 4> A;
+    for (std::size_t i = 0; i < 4; ++i) {
+        A(i, i) = 2.0;
+        if (i + 1 < 4) {
+            A(i, i + 1) = 1.0;
+            A(i + 1, i) = 1.0;
+        }
+    }
+    double target = 2.0 + 2.0 * std::cos(std::numbers::pi / 5.0);
+    assert_true(make_operator(A).symmetric());
+    for (double offset : {1e-9, -1e-9, 0.3}) {
+        auto [lambda, v] = inverse_iteration(make_operator(A), target + offset, 50);
+        auto [lambda_dense, v_dense] = inverse_iteration(A, target + offset, 50);
+        assert_near(lambda, target, 1e-10);
+        assert_near(lambda_dense, target, 1e-10);
+        auto r = A * v - v * lambda;
+        assert_true(l2_norm(r) < 1e-9);
+        // Both overloads pick the eigenvector sign the same way.
+        for (std::size_t i = 0; i < 4; ++i) {
+            assert_near(v[i], v_dense[i], 1e-8);
+        }
+    }
+}
+
+RUN_ALL_TESTS()
@@ -93,4 +93,27 @@ TEST(matrix_inverse) {
     }
 }
 
+TEST(matrix_inverse_ill_conditioned) {
+    // A 6x6 Hilbert matrix has condition number about 1.5e7: badly
+    // conditioned, but LU pivots stay well clear of zero, so it inverts.
+    Matrix<double, 6, 6> H;
+    for (std::size_t i = 0; i < 6; ++i) {
+        for (std::size_t j = 0; j < 6; ++j) {
+            H(i, j) = 1.0 / static_cast<double>(i + j + 1);
+        }
+    }
+    assert_true(!lu_decompose(H).singular);
+
+    auto inv = matrix_inverse(H);
+    assert_true(inv.has_value());
+    // The (0, 0) entry of the inverse of the n x n Hilbert matrix is n^2.
+    assert_near((*inv)(0, 0), 36.0, 1e-6);
+    auto identity = H * (*inv);
+    for (std::size_t i = 0; i < 6; ++i) {
+        for (std::size_t j = 0; j < 6; ++j) {
+            assert_near(identity(i, j), i == j ? 1.0 : 0.0, 1e-7);
+        }
+    }
+}
+
 RUN_ALL_TESTS()
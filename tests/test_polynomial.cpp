@@ -0,0 +1,80 @@
+#include <math/core/polynomial.hpp>
+#include "test_framework.hpp"
+#include <array>
+#include <cmath>
+#include <span>
+#include <vector>
+
+using namespace math;
+using namespace math::test;
+
+TEST(horner_and_estrin_agree_on_exact_data) {
+    // Small integers at integer points: every scheme is exact.
+    constexpr std::array<double, 11> c = {3, -1, 4, 1, -5, 9, 2, -6, 5, 3, -5};
+    for (double x : {-3.0, -1.0, 0.0, 1.0, 2.0}) {
+        double expected = 0.0;
+        for (std::size_t k = c.size(); k-- > 0;) {
+            expected = expected * x + c[k];
+        }
+        assert_true(poly::horner(c, x) == expected);
+        assert_true(poly::estrin(c, x) == expected);
+        assert_true(poly::evaluate(c, x) == expected);
+    }
+    constexpr std::array<double, 0> empty{};
+    assert_true(poly::horner(empty, 2.0) == 0.0);
+}
+
+TEST(polynomial_constexpr) {
+    static constexpr Polynomial<int, 3> p{{1, 2, 3}};
+    static_assert(p(2) == 17);
+    static_assert(Polynomial<int, 3>::size == 3);
+
+    constexpr long double table[] = {0.5L, 0.25L, 0.125L};
+    static constexpr auto q = Polynomial<float, 3>::from(table);
+    static_assert(q(2.0f) == 1.5f);
+}
+
+TEST(polynomial_long_estrin) {
+    // Truncated exp series at 0.3: Estrin with a Horner head stays within
+    // a couple of ulps of the Horner value.
+    std::array<double, 16> c{};
+    double f = 1.0;
+    for (std::size_t k = 0; k < c.size(); ++k) {
+        c[k] = 1.0 / f;
+        f *= static_cast<double>(k + 1);
+    }
+    Polynomial<double, 16> p{c};
+    assert_near(p(0.3), std::exp(0.3), 4e-16);
+    assert_near(p(-0.3), std::exp(-0.3), 4e-16);
+}
+
+TEST(rational) {
+    // (1 + x) / (1 - x + x^2)
+    static constexpr Rational<double, 2, 3> r{{{1.0, 1.0}}, {{1.0, -1.0, 1.0}}};
+    static_assert(r(0.0) == 1.0);
+    for (double x : {-2.0, 0.5, 3.0}) {
+        assert_near(r(x), (1.0 + x) / (1.0 - x + x * x), 1e-15);
+    }
+}
+
+TEST(polynomial_batch) {
+    static constexpr Polynomial<double, 9> p{{1, -2, 3, -4, 5, -6, 7, -8, 9}};
+    static constexpr Rational<double, 3, 2> r{{{1.0, 2.0, 1.0}}, {{2.0, 1.0}}};
+    std::vector<double> x = {-1.5, -0.25, 0.0, 0.75, 2.0};
+    std::vector<double> out(x.size());
+
+    p(std::span<const double>(x), std::span<double>(out));
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], p(x[i]), 0.0);
+    }
+    r(std::span<const double>(x), std::span<double>(out));
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], r(x[i]), 0.0);
+    }
+
+    std::vector<double> shorter(2);
+    p(std::span<const double>(x), std::span<double>(shorter));
+    assert_near(shorter[1], p(x[1]), 0.0);
+}
+
+RUN_ALL_TESTS()
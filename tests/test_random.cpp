@@ -0,0 +1,238 @@
+#include <math/random/engine.hpp>
+#include <math/random/uniform.hpp>
+#include <math/random/ziggurat.hpp>
+#include <math/random/parallel.hpp>
+#include <math/exec/thread_pool.hpp>
+#include "test_framework.hpp"
+#include <cmath>
+#include <span>
+#include <vector>
+
+using namespace math;
+using namespace math::test;
+
+namespace {
+
+// Fraction of samples below x compared with cdf(x), allowing five
+// binomial standard deviations.
+template<typename Cdf>
+void check_cdf(const std::vector<double>& s, std::initializer_list<double> points, Cdf cdf) {
+    double n = static_cast<double>(s.size());
+    for (double x : points) {
+        double below = 0.0;
+        for (double v : s) {
+            below += v < x ? 1.0 : 0.0;
+        }
+        double p = cdf(x);
+        assert_near(below / n, p, 5.0 * std::sqrt(p * (1.0 - p) / n) + 1e-12);
+    }
+}
+
+double mean_of(const std::vector<double>& s) {
+    double sum = 0.0;
+    for (double v : s) {
+        sum += v;
+    }
+    return sum / static_cast<double>(s.size());
+}
+
+double central_moment(const std::vector<double>& s, double mean, int k) {
+    double sum = 0.0;
+    for (double v : s) {
+        sum += std::pow(v - mean, k);
+    }
+    return sum / static_cast<double>(s.size());
+}
+
+double normal_cdf(double x) {
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+}
+
+TEST(philox_known_answers) {
+    // Random123 known-answer vectors for Philox4x32-10.
+    using P = random::Philox4x32;
+    auto r = P::block({0, 0, 0, 0}, {0, 0});
+    assert_true(r == P::counter_type{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u});
+    r = P::block({0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}, {0xffffffffu, 0xffffffffu});
+    assert_true(r == P::counter_type{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu});
+    r = P::block({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}, {0xa4093822u, 0x299f31d0u});
+    assert_true(r == P::counter_type{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u});
+}
+
+TEST(xoshiro_reference_outputs) {
+    random::Xoshiro256pp g(std::array<std::uint64_t, 4>{1, 2, 3, 4});
+    assert_true(g() == 41943041ULL);
+    assert_true(g() == 58720359ULL);
+    assert_true(g() == 3588806011781223ULL);
+    assert_true(g() == 3591011842654386ULL);
+}
+
+TEST(xoshiro_jump_and_lanes) {
+    random::Xoshiro256pp base(42);
+    random::Xoshiro256pp jumped = base;
+    jumped.jump();
+    assert_true(!(jumped == base));
+    random::Xoshiro256pp long_jumped = base;
+    long_jumped.long_jump();
+    assert_true(!(long_jumped == jumped));
+
+    // Lane k of the lockstep engine is the seed engine jumped k times.
+    constexpr std::size_t W = random::Xoshiro256ppLanes<>::lanes;
+    random::Xoshiro256ppLanes<> lanes(base);
+    std::vector<std::uint64_t> out(W * 37 + 3);
+    lanes.generate(std::span<std::uint64_t>(out));
+    std::vector<random::Xoshiro256pp> ref;
+    random::Xoshiro256pp s = base;
+    for (std::size_t k = 0; k < W; ++k) {
+        ref.push_back(s);
+        s.jump();
+    }
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        assert_true(out[i] == ref[i % W]());
+    }
+
+    // Word-at-a-time calls continue the same interleaved sequence.
+    random::Xoshiro256ppLanes<> one(base);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        assert_true(one() == out[i]);
+    }
+}
+
+TEST(philox_seek_and_generate) {
+    random::Philox4x32 g(2024, 7);
+    std::vector<std::uint64_t> seq(1001);
+    for (auto& w : seq) {
+        w = g();
+    }
+    assert_true(g.position() == 1001);
+
+    random::Philox4x32 h(2024, 7);
+    h.discard(1);
+    std::vector<std::uint64_t> bulk(999);
+    h.generate(std::span<std::uint64_t>(bulk));
+    for (std::size_t i = 0; i < bulk.size(); ++i) {
+        assert_true(bulk[i] == seq[i + 1]);
+    }
+    assert_true(h() == seq[1000]);
+
+    random::Philox4x32 k(2024, 7);
+    k.seek(555);
+    assert_true(k() == seq[555]);
+    assert_true(!(random::Philox4x32(2024, 8)() == seq[0]));
+}
+
+TEST(uniform_fill) {
+    random::Xoshiro256pp g(1);
+    std::vector<double> u(200000);
+    random::uniform(g, std::span<double>(u), -2.0, 3.0);
+    for (double v : u) {
+        assert_true(v >= -2.0 && v < 3.0);
+    }
+    assert_near(mean_of(u), 0.5, 5.0 * 5.0 / std::sqrt(12.0 * 200000.0));
+    check_cdf(u, {-1.0, 0.0, 2.5}, [](double x) { return (x + 2.0) / 5.0; });
+
+    random::Philox4x32 p(3);
+    std::vector<float> f(1000);
+    random::uniform(p, std::span<float>(f));
+    for (float v : f) {
+        assert_true(v >= 0.0f && v < 1.0f);
+    }
+    assert_near(random::to_unit<double>(~std::uint64_t{0}), 1.0 - 0x1.0p-52, 0.0);
+    assert_near(random::to_open_unit<double>(~std::uint64_t{0}), 0x1.0p-52, 0.0);
+}
+
+TEST(normal_samples) {
+    random::Xoshiro256ppLanes<> g(5);
+    std::vector<double> z(1000000);
+    random::normal(g, std::span<double>(z));
+    double n = static_cast<double>(z.size());
+    double m = mean_of(z);
+    assert_near(m, 0.0, 5.0 / std::sqrt(n));
+    assert_near(central_moment(z, m, 2), 1.0, 5.0 * std::sqrt(2.0 / n));
+    assert_near(central_moment(z, m, 4), 3.0, 5.0 * std::sqrt(96.0 / n));
+    // Points inside the base layer, in the wedges and in the tail.
+    check_cdf(z, {-3.6, -2.0, -0.3, 0.0, 0.9, 2.5, 3.5}, normal_cdf);
+
+    random::Xoshiro256pp s(9);
+    std::vector<double> w(200000);
+    for (auto& v : w) {
+        v = random::normal(s);
+    }
+    check_cdf(w, {-2.0, 0.0, 1.0, 3.0}, normal_cdf);
+}
+
+TEST(exponential_samples) {
+    random::Philox4x32 g(11);
+    std::vector<double> e(1000000);
+    random::exponential(g, std::span<double>(e), 2.0);
+    double n = static_cast<double>(e.size());
+    for (double v : e) {
+        assert_true(v >= 0.0);
+    }
+    assert_near(mean_of(e), 0.5, 5.0 * 0.5 / std::sqrt(n));
+    check_cdf(e, {0.01, 0.3, 1.0, 3.0, 4.5}, [](double x) { return -std::expm1(-2.0 * x); });
+
+    random::Xoshiro256pp s(13);
+    std::vector<double> w(200000);
+    for (auto& v : w) {
+        v = random::exponential(s);
+    }
+    check_cdf(w, {0.5, 2.0, 8.0}, [](double x) { return -std::expm1(-x); });
+}
+
+TEST(parallel_fill_is_reproducible) {
+    random::Philox4x32 g(77, 3);
+    std::size_t n = 10 * random::stream_block + 123;
+    std::vector<double> a(n), b(n), c(n);
+    random::Philox4x32 ga = g, gb = g, gc = g;
+    random::normal(exec::seq, ga, std::span<double>(a), 1.0, 2.0);
+    random::normal(exec::par.with_grain(1), gb, std::span<double>(b), 1.0, 2.0);
+    exec::ThreadPool pool(3);
+    random::normal(exec::par.with_grain(2).on(pool), gc, std::span<double>(c), 1.0, 2.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        assert_true(a[i] == b[i] && a[i] == c[i]);
+    }
+    assert_true(ga.position() == gb.position() && ga.position() == gc.position());
+
+    std::vector<float> u1(n), u2(n);
+    random::Philox4x32 g1 = g, g2 = g;
+    random::uniform(exec::seq, g1, std::span<float>(u1));
+    random::uniform(exec::par.with_grain(3), g2, std::span<float>(u2));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert_true(u1[i] == u2[i]);
+    }
+    check_cdf(std::vector<double>(a.begin(), a.end()), {-1.0, 1.0, 4.0}, [](double x) { return normal_cdf((x - 1.0) / 2.0); });
+}
+
+TEST(parallel_fill_advances_generator) {
+    // Successive fills from one generator continue its stream.
+    random::Philox4x32 g(5);
+    std::size_t n = 3 * random::stream_block;
+    std::vector<double> first(n), second(n), whole(2 * n);
+    random::exponential(exec::par.with_grain(1), g, std::span<double>(first));
+    random::exponential(exec::seq, g, std::span<double>(second));
+    std::size_t same = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        same += first[i] == second[i] ? 1 : 0;
+    }
+    assert_true(same == 0);
+
+    random::Philox4x32 h(5);
+    random::exponential(exec::seq, h, std::span<double>(whole));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert_true(whole[i] == first[i] && whole[n + i] == second[i]);
+    }
+    assert_true(g.position() == h.position());
+
+    // The fill starts from wherever g is, not from the start of its stream.
+    random::Philox4x32 fresh(5), moved(5);
+    moved.discard(1);
+    std::vector<double> u(8), v(8);
+    random::uniform(exec::seq, fresh, std::span<double>(u));
+    random::uniform(exec::seq, moved, std::span<double>(v));
+    assert_true(u[0] != v[0]);
+}
+
+RUN_ALL_TESTS()
@@ -1,5 +1,7 @@
 #include <math/special/beta.hpp>
 #include "test_framework.hpp"
+#include <span>
+#include <vector>
 
 using namespace math;
 using namespace math::test;
@@ -15,15 +17,89 @@ TEST(log_beta) {
     assert_near(log_beta(1.0, 1.0), 0.0, 1e-10);
     assert_near(std::exp(log_beta(2.0, 3.0)), 0.0833333333, 1e-8);
 }
-// See header 
-/*TEST(incomplete_beta_endpoints) {*/
-/*    assert_near(incomplete_beta(0.0, 2.0, 3.0), 0.0, 1e-10);*/
-/*    assert_near(incomplete_beta(1.0, 2.0, 3.0), 1.0, 1e-10);*/
-/*}*/
-/**/
-/*TEST(regularized_incomplete_beta) {*/
-/*    double result = regularized_incomplete_beta(0.5, 2.0, 2.0);*/
-/*    assert_near(result, 0.5, 1e-6);*/
-/*}*/
+
+TEST(log_beta_large) {
+    assert_near(log_beta(1e7, 1e7) / -13862950.404734595683, 1.0, 1e-15);
+    assert_near(log_beta(1e6, 3.5) / -47.153317725523510146, 1.0, 1e-14);
+    assert_near(log_beta(0.5, 1e8) / -8.637975427801482649, 1.0, 1e-14);
+}
+
+TEST(incomplete_beta_endpoints) {
+    assert_near(incomplete_beta(0.0, 2.0, 3.0), 0.0, 1e-10);
+    assert_near(incomplete_beta(1.0, 2.0, 3.0), 1.0, 1e-10);
+}
+
+TEST(regularized_incomplete_beta) {
+    double result = regularized_incomplete_beta(0.5, 2.0, 2.0);
+    assert_near(result, 0.5, 1e-6);
+}
+
+TEST(regularized_incomplete_beta_values) {
+    // I_x(2, 3) = 6x^2 - 8x^3 + 3x^4
+    for (double x : {0.05, 0.3, 0.6, 0.95}) {
+        double expected = 6 * x * x - 8 * x * x * x + 3 * x * x * x * x;
+        assert_near(regularized_incomplete_beta(x, 2.0, 3.0), expected, 1e-14);
+    }
+    // I_x(a, 1) = x^a
+    assert_near(regularized_incomplete_beta(0.3, 0.5, 1.0), std::sqrt(0.3), 1e-14);
+    assert_near(regularized_incomplete_beta(0.2, 50.0, 60.0) / 1.0328973362230168e-09, 1.0, 1e-12);
+    assert_near(regularized_incomplete_beta(0.7, 5.0, 3.0), 0.6470695, 1e-14);
+    assert_true(std::isnan(regularized_incomplete_beta(1.5, 2.0, 3.0)));
+}
+
+TEST(regularized_incomplete_beta_large_shapes) {
+    assert_near(regularized_incomplete_beta(0.5, 1e6, 1e6), 0.5, 1e-15);
+    assert_near(regularized_incomplete_beta(0.5, 1e7, 1e7), 0.5, 1e-15);
+    assert_near(regularized_incomplete_beta(0.5001, 5e7, 5e7), 0.97724986886167340779, 1e-12);
+    assert_near(regularized_incomplete_beta(0.4999, 1e6, 1e6), 0.38864871786232204188, 1e-12);
+    assert_near(regularized_incomplete_beta(0.0909, 1e6, 1e7), 0.45834740559852653971, 1e-12);
+    assert_near(regularized_incomplete_beta(0.49, 1e6, 1e6) / 2.490453657610394275e-176, 1.0, 1e-10);
+    // A small shape against a large one: slow for the continued fraction
+    assert_near(regularized_incomplete_beta(1e-5, 0.01, 1000.0), 0.96034276341683164960, 1e-13);
+    assert_near(regularized_incomplete_beta(0.9999, 1000.0, 0.1), 0.17247846418621694696, 1e-13);
+}
+
+TEST(regularized_incomplete_beta_inverse) {
+    const double params[][2] = {{2.0, 3.0}, {0.5, 0.5}, {0.3, 4.0}, {50.0, 60.0}, {5.0, 0.8}};
+    for (const auto& ab : params) {
+        for (double p : {1e-6, 0.01, 0.25, 0.5, 0.9, 0.999}) {
+            double x = regularized_incomplete_beta_inv(p, ab[0], ab[1]);
+            assert_near(regularized_incomplete_beta(x, ab[0], ab[1]), p, 1e-12 + 1e-10 * p);
+        }
+    }
+    // Skewed shapes and deep tails: I_x(a, 1) = x^a and I_x(1, b) = 1 - (1 - x)^b
+    for (double a : {10.0, 100.0, 1e4}) {
+        for (double p : {1e-300, 1e-12, 0.3, 1.0 - 1e-8}) {
+            double x = std::pow(p, 1.0 / a);
+            assert_near(regularized_incomplete_beta_inv(p, a, 1.0), x, 1e-14 * x);
+            double y = -std::expm1(std::log1p(-p) / a);
+            assert_near(regularized_incomplete_beta_inv(p, 1.0, a), y, 1e-13 * y);
+        }
+    }
+    assert_near(regularized_incomplete_beta_inv(1e-12, 100.0, 1.0), 0.75857757502918377, 1e-15);
+    assert_near(regularized_incomplete_beta_inv(1.0 - 1e-8, 1.0, 100.0), 0.16823622885553487, 1e-15);
+    // At p = 0.8 the root is 1 - 3e-8, where one ulp of x moves I by 4e-10.
+    for (double p : {1e-300, 1e-12, 0.8}) {
+        double x = regularized_incomplete_beta_inv(p, 2.5, 0.1);
+        assert_near(regularized_incomplete_beta(x, 2.5, 0.1), p, 1e-10 * p);
+    }
+    assert_near(regularized_incomplete_beta_inv(0.0, 2.0, 3.0), 0.0, 0.0);
+    assert_near(regularized_incomplete_beta_inv(1.0, 2.0, 3.0), 1.0, 0.0);
+}
+
+TEST(regularized_incomplete_beta_batch) {
+    std::vector<double> x = {0.0, 0.1, 0.4, 0.7, 1.0};
+    std::vector<double> out(x.size());
+    regularized_incomplete_beta(std::span<const double>(x), std::span<double>(out), 2.5, 4.0);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], regularized_incomplete_beta(x[i], 2.5, 4.0), 1e-15);
+    }
+
+    std::vector<double> q(x.size());
+    regularized_incomplete_beta_inv(std::span<const double>(out), std::span<double>(q), 2.5, 4.0);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(q[i], x[i], 1e-10);
+    }
+}
 
 RUN_ALL_TESTS()
@@ -1,5 +1,8 @@
 #include <math/special/erf.hpp>
 #include "test_framework.hpp"
+#include <limits>
+#include <span>
+#include <vector>
 
 using namespace math;
 using namespace math::test;
@@ -34,6 +37,53 @@ TEST(erf_inverse) {
     assert_near(erf(erf_inv(0.8)), 0.8, 1e-3);
 }
 
+TEST(erf_precise_accuracy) {
+    // References from a 50-digit series evaluation.
+    assert_near(erf(0.25) / 0.27632639016823696, 1.0, 4e-16);
+    assert_near(erf(1.5) / 0.96610514647531076, 1.0, 4e-16);
+    assert_near(erfc(3.0) / 2.2090496998585441e-05, 1.0, 2e-15);
+    assert_near(erfc(10.0) / 2.0884875837625449e-45, 1.0, 2e-15);
+    assert_near(erfc(26.0) / 5.6631924088561432e-296, 1.0, 2e-15);
+    assert_near(erfc(-2.0), 1.9953222650189528, 4e-16);
+    assert_near(erf(30.0), 1.0, 0.0);
+    assert_near(erfc(30.0), 0.0, 0.0);
+    assert_true(std::isnan(erf(std::numeric_limits<double>::quiet_NaN())));
+    for (double x = -6.0; x <= 6.0; x += 0.0137) {
+        assert_near(erf(x), std::erf(x), 1e-15);
+        assert_near(erfc(x) / std::erfc(x), 1.0, 3e-15);
+    }
+}
+
+TEST(erf_fast_tier) {
+    for (double x = -4.0; x <= 4.0; x += 0.0173) {
+        assert_near(erf(x, accuracy::fast), std::erf(x), 2e-7);
+        assert_near(erfc(x, accuracy::fast), std::erfc(x), 2e-7);
+        assert_near(erf_inv(0.2499 * x, accuracy::fast), erf_inv(0.2499 * x), 1e-6);
+    }
+}
+
+TEST(erf_inverse_precise) {
+    for (double p = -0.999; p < 1.0; p += 0.00731) {
+        double y = erf_inv(p);
+        assert_near(std::erf(y), p, 2e-15);
+    }
+    for (double q : {1e-3, 1e-8, 1e-15}) {
+        double y = erf_inv(1.0 - q);
+        assert_near(std::erfc(y) / (1.0 - (1.0 - q)), 1.0, 1e-14);
+        assert_near(erf_inv(q - 1.0), -y, 0.0);
+    }
+    assert_true(std::isinf(erf_inv(1.0)) && erf_inv(1.0) > 0);
+    assert_true(std::isinf(erf_inv(-1.0)) && erf_inv(-1.0) < 0);
+    assert_true(std::isnan(erf_inv(1.5)));
+    assert_near(erf_inv(0.5f), 0.476936276f, 1e-6f);
+}
+
+TEST(normal_cdf_lower_tail) {
+    assert_near(normal_cdf(-10.0) / 7.6198530241605255e-24, 1.0, 2e-15);
+    assert_near(normal_cdf(-30.0) / 4.9067139271481872e-198, 1.0, 2e-15);
+    assert_near(normal_cdf(-10.0, 0.0, 1.0, accuracy::fast), 0.0, 1e-15);
+}
+
 TEST(normal_cdf) {
     assert_near(normal_cdf(0.0, 0.0, 1.0), 0.5, 1e-8);
     assert_near(normal_cdf(1.0, 0.0, 1.0), 0.8413447460, 1e-8);
@@ -45,4 +95,109 @@ TEST(normal_pdf) {
     assert_near(normal_pdf(1.0, 0.0, 1.0), 0.2419707245, 1e-8);
 }
 
+TEST(normal_quantile_values) {
+    // References from bisection on a 120-digit normal CDF.
+    assert_near(normal_quantile(0.975) / 1.9599639845400543, 1.0, 1e-15);
+    assert_near(normal_quantile(0.3) / -0.52440051270804078, 1.0, 1e-15);
+    assert_near(normal_quantile(1e-10) / -6.3613409024040566, 1.0, 1e-15);
+    assert_near(normal_quantile(1e-300) / -37.047096299361201, 1.0, 1e-15);
+    assert_near(normal_quantile(0.5), 0.0, 0.0);
+    assert_near(normal_quantile(0.975, 10.0, 2.0), 10.0 + 2.0 * 1.9599639845400543, 1e-14);
+    assert_true(std::isinf(normal_quantile(0.0)) && normal_quantile(0.0) < 0);
+    assert_true(std::isinf(normal_quantile(1.0)) && normal_quantile(1.0) > 0);
+    assert_true(std::isnan(normal_quantile(1.5)));
+    for (double p = 0.0005; p < 1.0; p += 0.00973) {
+        assert_near(normal_cdf(normal_quantile(p)), p, 4e-16);
+        assert_near(normal_quantile(p, 0.0, 1.0, accuracy::fast), normal_quantile(p), 5e-9);
+    }
+}
+
+TEST(normal_quantile_batch) {
+    std::vector<double> p;
+    for (int i = 0; i < 1000; ++i) {
+        p.push_back((i + 0.5) / 1000.0);
+    }
+    p.push_back(0.0);
+    p.push_back(1.0);
+    p.push_back(1e-300);
+    p.push_back(-0.5);
+    std::vector<double> out(p.size());
+    std::span<const double> in(p);
+
+    normal_quantile(in, std::span<double>(out), 1.0, 3.0);
+    for (std::size_t i = 0; i < 1003; ++i) {
+        assert_near(out[i], normal_quantile(p[i], 1.0, 3.0), 0.0);
+    }
+    assert_true(std::isnan(out[1003]));
+
+    normal_quantile(in, std::span<double>(out), 0.0, 1.0, accuracy::fast);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        assert_near(out[i], normal_quantile(p[i], 0.0, 1.0, accuracy::fast), 0.0);
+    }
+
+    std::vector<float> pf = {0.1f, 0.5f, 0.99f};
+    std::vector<float> outf(pf.size());
+    normal_quantile(std::span<const float>(pf), std::span<float>(outf));
+    assert_near(outf[0], -1.28155157f, 1e-6f);
+    assert_near(outf[2], 2.32634787f, 1e-6f);
+}
+
+TEST(batch_matches_scalar) {
+    std::vector<double> x;
+    for (int i = -400; i <= 400; ++i) {
+        x.push_back(0.015 * i);
+    }
+    std::vector<double> out(x.size());
+    std::span<const double> in(x);
+
+    special::erf(in, std::span<double>(out));
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], special::erf(x[i]), 1e-15);
+    }
+    special::erfc(in, std::span<double>(out));
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], special::erfc(x[i]), 1e-15);
+    }
+    normal_cdf(in, std::span<double>(out), 0.5, 2.0);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], special::normal_cdf(x[i], 0.5, 2.0), 1e-14);
+    }
+    normal_pdf(in, std::span<double>(out), 0.5, 2.0);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], special::normal_pdf(x[i], 0.5, 2.0), 1e-14);
+    }
+}
+
+TEST(batch_fast_matches_scalar) {
+    std::vector<double> x;
+    for (int i = -300; i <= 300; ++i) {
+        x.push_back(0.02 * i);
+    }
+    std::vector<double> out(x.size());
+    std::span<const double> in(x);
+
+    special::erf(in, std::span<double>(out), accuracy::fast);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], special::erf(x[i], accuracy::fast), 1e-15);
+    }
+    special::erfc(in, std::span<double>(out), accuracy::fast);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], special::erfc(x[i], accuracy::fast), 1e-15);
+    }
+    normal_cdf(in, std::span<double>(out), 0.0, 1.0, accuracy::fast);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], special::normal_cdf(x[i], 0.0, 1.0, accuracy::fast), 1e-14);
+    }
+}
+
+TEST(batch_float_and_edges) {
+    std::vector<float> x = {0.0f, -0.5f, 1.0f, 30.0f, -30.0f};
+    std::vector<float> out(x.size());
+    special::erf(std::span<const float>(x), std::span<float>(out));
+    assert_near(out[2], 0.8427007929f, 1e-6f);
+    assert_near(out[1], -special::erf(0.5f), 1e-6f);
+    assert_true(out[3] == 1.0f);
+    assert_true(out[4] == -1.0f);
+}
+
 RUN_ALL_TESTS()
@@ -1,21 +1,25 @@
 #include <math/special/gamma.hpp>
 #include "test_framework.hpp"
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <vector>
 
 using namespace math;
 using namespace math::test;
 using namespace math::special;
 
 TEST(gamma_integers) {
-    assert_near(gamma(1.0), 1.0, 1e-10);
-    assert_near(gamma(2.0), 1.0, 1e-10);
-    assert_near(gamma(3.0), 2.0, 1e-10);
-    assert_near(gamma(4.0), 6.0, 1e-10);
-    assert_near(gamma(5.0), 24.0, 1e-10);
+    assert_near(special::gamma(1.0), 1.0, 1e-10);
+    assert_near(special::gamma(2.0), 1.0, 1e-10);
+    assert_near(special::gamma(3.0), 2.0, 1e-10);
+    assert_near(special::gamma(4.0), 6.0, 1e-10);
+    assert_near(special::gamma(5.0), 24.0, 1e-10);
 }
 
 TEST(gamma_half_integers) {
-    assert_near(gamma(0.5), std::sqrt(std::numbers::pi), 1e-10);
-    assert_near(gamma(1.5), 0.5 * std::sqrt(std::numbers::pi), 1e-10);
+    assert_near(special::gamma(0.5), std::sqrt(std::numbers::pi), 1e-10);
+    assert_near(special::gamma(1.5), 0.5 * std::sqrt(std::numbers::pi), 1e-10);
 }
 
 TEST(log_gamma) {
@@ -24,6 +28,17 @@ TEST(log_gamma) {
     assert_near(log_gamma(10.0), std::log(362880.0), 1e-8);
 }
 
+TEST(log_gamma_half_ratio) {
+    // Gamma(x + 1/2) / Gamma(x) at x = 1 is sqrt(pi) / 2.
+    assert_near(log_gamma_half_ratio(1.0), 0.5 * std::log(std::numbers::pi) - std::log(2.0), 1e-14);
+    for (double x : {3.0, 9.75, 10.0, 10.5, 40.0}) {
+        assert_near(log_gamma_half_ratio(x), std::lgamma(x + 0.5) - std::lgamma(x), 1e-13);
+    }
+    // Far out the two log gammas are ~1e13; the ratio keeps full accuracy.
+    double x = 1e12;
+    assert_near(log_gamma_half_ratio(x), 0.5 * std::log(x) - 0.125 / x, 1e-15);
+}
+
 TEST(factorial) {
     assert_near(factorial<double>(0), 1.0, 1e-10);
     assert_near(factorial<double>(5), 120.0, 1e-10);
@@ -36,4 +51,151 @@ TEST(binomial_coefficient) {
     assert_near(binomial_coefficient<double>(20, 10), 184756.0, 1e-6);
 }
 
+TEST(factorial_table) {
+    double exact = 1.0;
+    for (int n = 1; n <= 22; ++n) {
+        exact *= n;
+        assert_near(factorial<double>(n), exact, 0.0);
+    }
+    assert_near(factorial<double>(170) / 7.257415615307998967e306, 1.0, 1e-16);
+    assert_true(std::isinf(factorial<double>(171)));
+    assert_near(factorial<float>(34) / 2.9523279903960414e38f, 1.0f, 1e-7f);
+    assert_true(std::isnan(factorial<double>(-1)));
+}
+
+TEST(log_factorial) {
+    assert_near(log_factorial<double>(0), 0.0, 0.0);
+    assert_near(log_factorial<double>(1), 0.0, 0.0);
+    for (int n : {2, 10, 170, 1023, 1024, 5000}) {
+        assert_near(log_factorial<double>(n) / std::lgamma(n + 1.0), 1.0, 1e-14);
+    }
+    assert_near(log_factorial<double, 16>(100), log_factorial<double>(100), 1e-12);
+}
+
+TEST(binomial_coefficient_exact) {
+    assert_near(binomial_coefficient<double>(52, 5), 2598960.0, 0.0);
+    assert_near(binomial_coefficient<double>(67, 33), static_cast<double>(14226520737620288370ull), 0.0);
+    assert_near(binomial_coefficient<double>(100, 50) / 1.00891344545564193334812497256e29, 1.0, 1e-15);
+    // Exact past the table while C(n, k) fits in 64 bits.
+    assert_near(binomial_coefficient<double>(100, 10), 17310309456440.0, 0.0);
+    assert_near(binomial_coefficient<double>(1000, 994), 1368173298991500.0, 0.0);
+    // Beyond that within about 2 ulp, through the factorials or Stirling.
+    assert_near(binomial_coefficient<double>(1000, 500) / 2.7028824094543656951561469362597e299, 1.0, 5e-16);
+    assert_near(binomial_coefficient<double>(1024, 300) / 2.4977680613028998146e267, 1.0, 5e-16);
+    assert_near(binomial_coefficient<double>(100000, 40) / 1.2160935604624695741e152, 1.0, 5e-16);
+    assert_near(binomial_coefficient<double>(1000000000, 3) / 1.66666666166666667e26, 1.0, 5e-16);
+    assert_true(std::isinf(binomial_coefficient<double>(5000, 2500)));
+    assert_near(binomial_coefficient<double>(5, 7), 0.0, 0.0);
+    assert_near(log_binomial_coefficient<double>(1000, 500), std::log(2.7028824094543656951561469362597e299), 1e-12);
+}
+
+TEST(digamma_values) {
+    assert_near(digamma(1.0), -0.5772156649015329, 1e-9);
+    assert_near(digamma(0.5), -1.9635100260214235, 1e-9);
+    assert_near(digamma(10.0), 2.2517525890667211, 1e-9);
+}
+
+TEST(digamma_precise) {
+    // Relative accuracy holds through the positive root.
+    assert_near(digamma(1.4616321449683622) / -9.2412655217294274792e-17, 1.0, 1e-13);
+    assert_near(digamma(100.25) / 4.6026712432747125591, 1.0, 1e-15);
+    assert_near(digamma(1e-8) / -100000000.57721566, 1.0, 1e-15);
+    // Reflection for negative non-integers; poles are NaN.
+    assert_near(digamma(-0.5) / 0.036489973978576520559, 1.0, 1e-14);
+    assert_near(digamma(-2.7) / -1.1153471291406896119, 1.0, 1e-14);
+    assert_true(std::isnan(digamma(0.0)));
+    assert_true(std::isnan(digamma(-3.0)));
+}
+
+TEST(trigamma_values) {
+    assert_near(trigamma(0.5) / (std::numbers::pi * std::numbers::pi / 2.0), 1.0, 1e-15);
+    assert_near(trigamma(1.0) / (std::numbers::pi * std::numbers::pi / 6.0), 1.0, 1e-15);
+    assert_near(trigamma(3.7) / 0.31003785767003830216, 1.0, 1e-15);
+    assert_near(trigamma(-1.25) / 19.181879647671606498, 1.0, 1e-14);
+    assert_true(std::isnan(trigamma(-1.0)));
+}
+
+TEST(polygamma_values) {
+    assert_near(polygamma(0, 3.5), digamma(3.5), 0.0);
+    assert_near(polygamma(1, 3.5), trigamma(3.5), 0.0);
+    assert_near(polygamma(2, 0.5) / -16.828796644234319996, 1.0, 1e-15);
+    assert_near(polygamma(2, 7.0) / -0.023530472985855237466, 1.0, 1e-15);
+    assert_near(polygamma(3, 2.5) / 0.22390584881725205126, 1.0, 1e-15);
+    assert_near(polygamma(5, 40.0) / 2.4938943509996702254e-7, 1.0, 1e-14);
+    assert_near(polygamma(4, -0.3) / 9731.8349562335204389, 1.0, 1e-13);
+    assert_true(std::isnan(polygamma(-1, 2.0)));
+    assert_true(std::isnan(polygamma(3, -2.0)));
+}
+
+TEST(polygamma_batch) {
+    std::vector<double> x = {1e-3, 0.4, 1.4616321449683622, 2.0, 9.99, 10.0, 55.0, -0.5, 0.0};
+    std::vector<double> out(x.size());
+    std::span<const double> in(x);
+
+    trigamma(in, std::span<double>(out));
+    for (std::size_t i = 0; i + 1 < x.size(); ++i) {
+        assert_near(out[i] / trigamma(x[i]), 1.0, 1e-15);
+    }
+    assert_true(std::isnan(out.back()));
+    for (int n : {0, 1, 3}) {
+        polygamma(in, std::span<double>(out), n);
+        for (std::size_t i = 0; i + 1 < x.size(); ++i) {
+            assert_near(out[i] / polygamma(n, x[i]), 1.0, 1e-14);
+        }
+    }
+}
+
+TEST(batch_matches_scalar) {
+    std::vector<double> x;
+    for (int i = 1; i <= 600; ++i) {
+        x.push_back(0.05 * i);
+    }
+    x.push_back(-2.5);
+    x.push_back(0.0);
+    std::vector<double> out(x.size());
+    std::span<const double> in(x);
+
+    special::gamma(in, std::span<double>(out));
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i] / lanczos_gamma(x[i]), 1.0, 1e-12);
+    }
+    special::log_gamma(in, std::span<double>(out));
+    for (std::size_t i = 0; i + 2 < x.size(); ++i) {
+        assert_near(out[i], log_gamma(x[i]), 1e-12);
+    }
+    assert_true(std::isnan(out[x.size() - 2]));
+    special::digamma(in, std::span<double>(out));
+    for (std::size_t i = 0; i + 2 < x.size(); ++i) {
+        assert_near(out[i], digamma(x[i]), 1e-12);
+    }
+    assert_true(std::isnan(out[x.size() - 1]));
+}
+
+TEST(gamma_near_overflow) {
+    // Gamma stays finite up to x ~ 171.6 in both forms.
+    const double x[] = {143.5, 150.0, 170.5, 171.0, 171.6, 172.0};
+    const double expect[] = {3.2203704817308084463e+246, 3.808922637630569727e+260, 5.5620924145599996107e+305,
+                             7.2574156153079989674e+306, 1.585896909667256509e+308};
+    std::vector<double> out(std::size(x));
+    special::gamma(std::span<const double>(x), std::span<double>(out));
+    for (std::size_t i = 0; i < std::size(expect); ++i) {
+        assert_near(lanczos_gamma(x[i]) / expect[i], 1.0, 2e-13);
+        assert_near(out[i] / expect[i], 1.0, 5e-13);
+    }
+    assert_true(std::isinf(lanczos_gamma(172.0)) && std::isinf(out[5]));
+}
+
+TEST(lanczos_series) {
+    using L = special::detail::Lanczos<double>;
+    // A_g(0) = Gamma(1) e^t / sqrt(2 pi t) with t = g + 1/2.
+    constexpr double at_zero = L::series(0.0);
+    static_assert(at_zero > 0.0);
+    double t = L::g + 0.5;
+    assert_near(at_zero / (std::exp(t) / std::sqrt(2.0 * std::numbers::pi * t)), 1.0, 1e-14);
+    // The branching and select forms agree on both sides of the switch.
+    for (double z : {-0.5, 0.25, 1.0, 1.0 + 1e-12, 3.0, 170.0}) {
+        assert_near(L::series(z), L::series_select(z), 0.0);
+    }
+}
+
 RUN_ALL_TESTS()
@@ -0,0 +1,90 @@
+#include <math/special/incomplete_gamma.hpp>
+#include <math/special/erf.hpp>
+#include "test_framework.hpp"
+#include <span>
+#include <vector>
+
+using namespace math;
+using namespace math::test;
+using namespace math::special;
+
+TEST(gamma_pq_closed_forms) {
+    // Q(1, x) = e^-x, P(1/2, x) = erf(sqrt(x)), Q(2, x) = (1 + x) e^-x
+    for (double x : {0.01, 0.5, 1.0, 3.0, 20.0}) {
+        assert_near(gamma_q(1.0, x) / std::exp(-x), 1.0, 1e-14);
+        assert_near(gamma_p(0.5, x), std::erf(std::sqrt(x)), 1e-14);
+        assert_near(gamma_q(2.0, x) / ((1.0 + x) * std::exp(-x)), 1.0, 1e-14);
+    }
+    assert_near(gamma_p(3.0, 0.0), 0.0, 0.0);
+    assert_near(gamma_q(3.0, 0.0), 1.0, 0.0);
+}
+
+TEST(gamma_pq_reference_values) {
+    // a, x, Q(a, x), P(a, x)
+    const double cases[][4] = {
+        {3.0, 0.5, 9.85612322033029287e-01, 1.43876779669706873e-02},
+        {3.0, 10.0, 2.76939571551157579e-03, 9.97230604284488398e-01},
+        {25.0, 20.0, 8.43227378173762254e-01, 1.56772621826237718e-01},
+        {100.0, 100.0, 4.86701201720851351e-01, 5.13298798279148705e-01},
+        {1000.0, 950.0, 9.44945313769261941e-01, 5.50546862307380314e-02},
+    };
+    for (const auto& c : cases) {
+        assert_near(gamma_q(c[0], c[1]) / c[2], 1.0, 1e-13);
+        assert_near(gamma_p(c[0], c[1]) / c[3], 1.0, 1e-13);
+    }
+    // Deep upper tail keeps its relative accuracy.
+    assert_near(gamma_q(50.0, 200.0) / 1.69279799588570874e-37, 1.0, 1e-12);
+    assert_near(gamma_p(50.0, 200.0), 1.0, 0.0);
+}
+
+TEST(gamma_pq_invalid) {
+    assert_true(std::isnan(gamma_p(0.0, 1.0)));
+    assert_true(std::isnan(gamma_q(-1.0, 1.0)));
+    assert_true(std::isnan(gamma_p(2.0, -1.0)));
+    assert_true(std::isnan(gamma_p_inv(2.0, 1.5)));
+    assert_true(std::isnan(gamma_q_inv(2.0, -0.5)));
+}
+
+TEST(gamma_pq_inverse) {
+    for (double a : {0.1, 0.5, 1.0, 2.5, 10.0, 40.0, 500.0}) {
+        for (double p : {1e-12, 1e-4, 0.05, 0.5, 0.9, 0.999}) {
+            double x = gamma_p_inv(a, p);
+            assert_near(gamma_p(a, x) / p, 1.0, 1e-10);
+            double y = gamma_q_inv(a, p);
+            assert_near(gamma_q(a, y) / p, 1.0, 1e-10);
+        }
+    }
+    double tail = gamma_q_inv(5.0, 1e-300);
+    assert_near(gamma_q(5.0, tail) / 1e-300, 1.0, 1e-10);
+    assert_near(gamma_p_inv(2.0, 0.0), 0.0, 0.0);
+    assert_true(std::isinf(gamma_p_inv(2.0, 1.0)));
+    assert_true(std::isinf(gamma_q_inv(2.0, 0.0)));
+}
+
+TEST(gamma_pq_batch) {
+    std::vector<double> x = {0.0, 0.3, 2.0, 7.5, 30.0};
+    std::vector<double> out(x.size());
+    std::vector<double> back(x.size());
+    const double a = 4.5;
+
+    gamma_p(std::span<const double>(x), std::span<double>(out), a);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], gamma_p(a, x[i]), 0.0);
+    }
+    gamma_p_inv(std::span<const double>(out), std::span<double>(back), a);
+    for (std::size_t i = 1; i + 1 < x.size(); ++i) {
+        assert_near(back[i] / x[i], 1.0, 1e-10);
+    }
+
+    gamma_q(std::span<const double>(x), std::span<double>(out), a);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(out[i], gamma_q(a, x[i]), 0.0);
+    }
+    gamma_q_inv(std::span<const double>(out), std::span<double>(back), a);
+    assert_near(back[0], 0.0, 0.0);
+    for (std::size_t i = 1; i < x.size(); ++i) {
+        assert_near(back[i] / x[i], 1.0, 1e-10);
+    }
+}
+
+RUN_ALL_TESTS()
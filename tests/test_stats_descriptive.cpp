@@ -1,6 +1,10 @@
 #include <math/stats/descriptive/central.hpp>
 #include <math/stats/descriptive/dispersion.hpp>
 #include <math/stats/descriptive/correlation.hpp>
+#include <math/stats/descriptive/running.hpp>
+#include <math/stats/descriptive/describe.hpp>
+#include <math/stats/descriptive/order.hpp>
+#include <math/stats/descriptive/rank.hpp>
 #include "test_framework.hpp"
 
 using namespace math;
@@ -56,4 +60,334 @@ TEST(quantile_test) {
     assert_near(quantile(data, 0.75), 4.0, 1e-10);
 }
 
+TEST(parallel_policies) {
+    std::vector<double> x(50000), y(50000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(static_cast<double>(i));
+        y[i] = 0.5 * x[i] + std::cos(static_cast<double>(i));
+    }
+    auto par = exec::par.with_grain(4096);
+    assert_near(mean(exec::seq, x), mean(x), 1e-15);
+    assert_near(mean(par, x), mean(x), 1e-12);
+    assert_near(mean(exec::par_simd, x), mean(x), 1e-12);
+    assert_near(variance(par, x), variance(x), 1e-12);
+    assert_near(std_dev(exec::par_simd, x, false), std_dev(x, false), 1e-12);
+    assert_near(covariance(par, x, y), covariance(x, y), 1e-12);
+}
+
+TEST(deterministic_policy_reproducible) {
+    std::vector<double> x(70000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::exp(std::sin(static_cast<double>(i))) * 1e6;
+    }
+    exec::ThreadPool one(1);
+    exec::ThreadPool many(5);
+    double m1 = mean(exec::deterministic.on(one), x);
+    double m2 = mean(exec::deterministic.on(many).with_grain(1), x);
+    double v1 = variance(exec::deterministic.on(one), x);
+    double v2 = variance(exec::deterministic.on(many), x);
+    assert_true(m1 == m2);
+    assert_true(v1 == v2);
+    assert_near(m1, mean(x), 1e-6);
+}
+
+TEST(summation_policies) {
+    std::vector<double> x(100000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = 1e9 + std::sin(static_cast<double>(i));
+    }
+    double m = mean(x, summation::neumaier);
+    assert_near(mean(x), m, 1e-6);
+    assert_near(mean(x, summation::naive), m, 1e-4);
+    double v = variance(x, true, summation::dot2);
+    assert_near(variance(x), v, 1e-9);
+    assert_near(variance(x, true, summation::neumaier), v, 1e-9);
+    assert_near(covariance(x, x, true, summation::dot2), v, 1e-9);
+    assert_near(std_dev(x, false, summation::naive), std::sqrt(variance(x, false)), 1e-6);
+}
+
+TEST(running_stats_moments) {
+    std::vector<double> x(5000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        double t = static_cast<double>(i);
+        x[i] = std::exp(std::sin(0.7 * t)) + 0.1 * t;
+    }
+    double mu = mean(x);
+    double m2 = 0.0, m3 = 0.0, m4 = 0.0;
+    for (double v : x) {
+        double d = v - mu;
+        m2 += d * d;
+        m3 += d * d * d;
+        m4 += d * d * d * d;
+    }
+    double n = static_cast<double>(x.size());
+
+    RunningStats<double> batch{std::span<const double>(x)};
+    RunningStats<double> single;
+    for (double v : x) {
+        single.push(v);
+    }
+    for (const auto& r : {batch, single}) {
+        assert_true(r.count() == x.size());
+        assert_near(r.mean(), mu, 1e-12);
+        assert_near(r.variance(), variance(x), 1e-10);
+        assert_near(r.variance(false), variance(x, false), 1e-10);
+        assert_near(r.skewness(), std::sqrt(n) * m3 / std::pow(m2, 1.5), 1e-12);
+        assert_near(r.kurtosis(), n * m4 / (m2 * m2) - 3.0, 1e-12);
+        assert_near(r.min(), *std::min_element(x.begin(), x.end()), 0.0);
+        assert_near(r.max(), *std::max_element(x.begin(), x.end()), 0.0);
+        assert_near(r.sum(), mu * n, 1e-8);
+    }
+
+    RunningStats<double> empty;
+    assert_near(empty.variance(), 0.0, 0.0);
+    empty.push(3.0);
+    assert_near(empty.variance(), 0.0, 0.0);
+    assert_near(empty.variance(false), 0.0, 0.0);
+}
+
+TEST(running_stats_merge) {
+    std::vector<double> x(10007);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::cos(1.3 * static_cast<double>(i)) * static_cast<double>(i % 17);
+    }
+    RunningStats<double> whole{std::span<const double>(x)};
+
+    // Uneven shards, one of them empty, merged in a different order.
+    std::span<const double> all(x);
+    RunningStats<double> a(all.subspan(0, 3));
+    RunningStats<double> b(all.subspan(3, 6000));
+    RunningStats<double> c(all.subspan(6003, 0));
+    RunningStats<double> d(all.subspan(6003));
+    d.merge(c);
+    d.merge(a);
+    d.merge(b);
+    assert_true(d.count() == whole.count());
+    assert_near(d.mean(), whole.mean(), 1e-14);
+    assert_near(d.m2() / whole.m2(), 1.0, 1e-13);
+    assert_near(d.m3() / whole.m3(), 1.0, 1e-11);
+    assert_near(d.m4() / whole.m4(), 1.0, 1e-13);
+    assert_near(d.min(), whole.min(), 0.0);
+    assert_near(d.max(), whole.max(), 0.0);
+
+    exec::ThreadPool pool(3);
+    auto p = running_stats(exec::par.with_grain(1000).on(pool), all);
+    assert_near(p.mean(), whole.mean(), 1e-14);
+    assert_near(p.m2() / whole.m2(), 1.0, 1e-13);
+    assert_near(p.kurtosis(), whole.kurtosis(), 1e-12);
+}
+
+TEST(running_stats_large_offset) {
+    // Welford / Chan stay accurate where sum(x^2) - n mean^2 would not.
+    RunningStats<double> r;
+    for (double v : {4.0, 7.0, 13.0, 16.0}) {
+        r.push(1e9 + v);
+    }
+    assert_near(r.variance(), 30.0, 1e-6);
+
+    std::vector<double> x(4096);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = 1e9 + static_cast<double>(i % 4 == 0 ? 4 : i % 4 == 1 ? 7 : i % 4 == 2 ? 13 : 16);
+    }
+    RunningStats<double> s{std::span<const double>(x)};
+    assert_near(s.variance(false), 22.5, 1e-6);
+    assert_near(s.skewness(), 0.0, 1e-6);
+}
+
+TEST(running_covariance) {
+    std::vector<double> x(3001), y(3001);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        double t = static_cast<double>(i);
+        x[i] = std::sin(0.01 * t) + 5.0;
+        y[i] = 2.0 * x[i] + std::cos(0.37 * t);
+    }
+    RunningCovariance<double> batch{std::span<const double>(x), std::span<const double>(y)};
+    RunningCovariance<double> single;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        single.push(x[i], y[i]);
+    }
+    for (const auto& r : {batch, single}) {
+        assert_near(r.covariance(), covariance(x, y), 1e-12);
+        assert_near(r.correlation(), correlation(x, y), 1e-12);
+        assert_near(r.variance_x(), variance(x), 1e-12);
+        assert_near(r.mean_y(), mean(y), 1e-12);
+    }
+
+    std::span<const double> sx(x), sy(y);
+    RunningCovariance<double> left(sx.subspan(0, 1000), sy.subspan(0, 1000));
+    RunningCovariance<double> right(sx.subspan(1000), sy.subspan(1000));
+    left.merge(right);
+    assert_near(left.covariance(), batch.covariance(), 1e-13);
+    auto p = running_covariance(exec::par.with_grain(500), sx, sy);
+    assert_near(p.correlation(), batch.correlation(), 1e-13);
+}
+
+TEST(describe_summary) {
+    std::vector<double> x(7000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        double t = static_cast<double>(i);
+        x[i] = std::exp(std::cos(0.3 * t)) - 0.001 * t;
+    }
+    RunningStats<double> ref{std::span<const double>(x)};
+
+    // NaNs scattered through two chunks are counted and skipped.
+    std::vector<double> y = x;
+    std::vector<std::size_t> holes = {0, 5, 1500, 1501, 6999};
+    for (std::size_t i : holes) {
+        y[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+    std::vector<double> clean;
+    for (double v : y) {
+        if (!std::isnan(v)) {
+            clean.push_back(v);
+        }
+    }
+
+    auto s = describe(std::span<const double>(x));
+    assert_true(s.count == x.size() && s.nan_count == 0);
+    assert_near(s.mean, mean(x), 1e-13);
+    assert_near(s.variance, variance(x), 1e-12);
+    assert_near(s.std_dev, std_dev(x), 1e-12);
+    assert_near(s.sum, mean(x) * 7000.0, 1e-9);
+    assert_near(s.max - s.min, range(x), 0.0);
+    assert_near(s.skewness, ref.skewness(), 1e-12);
+    assert_near(s.kurtosis, ref.kurtosis(), 1e-12);
+
+    auto t = describe(std::span<const double>(y));
+    assert_true(t.count == clean.size() && t.nan_count == holes.size());
+    assert_near(t.mean, mean(clean), 1e-13);
+    assert_near(t.variance, variance(clean), 1e-12);
+    assert_near(t.min, *std::min_element(clean.begin(), clean.end()), 0.0);
+
+    auto p = describe(exec::par.with_grain(1000), std::span<const double>(y));
+    assert_true(p.count == t.count && p.nan_count == t.nan_count);
+    assert_near(p.mean, t.mean, 1e-13);
+    assert_near(p.kurtosis, t.kurtosis, 1e-12);
+
+    std::vector<float> nans(10, std::numeric_limits<float>::quiet_NaN());
+    auto e = describe(std::span<const float>(nans));
+    assert_true(e.count == 0 && e.nan_count == 10 && std::isnan(e.skewness));
+    assert_near(mad(std::vector<double>{1.0, 2.0, 3.0, 6.0}), 1.5, 1e-15);
+}
+
+TEST(selection_quantiles) {
+    // Shapes that trip up naive pivoting: sorted, reversed, organ pipe,
+    // heavy duplicates and constant, on both sides of the sampling cutoff.
+    for (std::size_t n : {1u, 2u, 7u, 600u, 601u, 5000u, 40001u}) {
+        std::vector<std::vector<double>> inputs(5, std::vector<double>(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            double t = static_cast<double>(i);
+            inputs[0][i] = t;
+            inputs[1][i] = static_cast<double>(n) - t;
+            inputs[2][i] = static_cast<double>(std::min(i, n - i));
+            inputs[3][i] = static_cast<double>((i * 7919) % 13);
+            inputs[4][i] = 2.5;
+        }
+        for (const auto& x : inputs) {
+            std::vector<double> sorted = x;
+            std::sort(sorted.begin(), sorted.end());
+            for (std::size_t k : {std::size_t{0}, n / 3, n - 1}) {
+                std::vector<double> y = x;
+                assert_near(select_nth(std::span<double>(y), k), sorted[k], 0.0);
+                for (std::size_t i = 0; i < k; ++i) {
+                    assert_true(y[i] <= y[k]);
+                }
+                for (std::size_t i = k + 1; i < n; ++i) {
+                    assert_true(y[k] <= y[i]);
+                }
+            }
+            double m = n % 2 == 1 ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+            assert_near(median(x), m, 0.0);
+            std::vector<double> qs = {0.0, 0.1, 0.5, 0.9, 0.99, 1.0, 1.5};
+            auto many = quantiles(x, std::span<const double>(qs));
+            for (std::size_t i = 0; i < qs.size(); ++i) {
+                double pos = qs[i] * static_cast<double>(n - 1);
+                std::size_t lo = static_cast<std::size_t>(std::floor(pos));
+                double w = pos - static_cast<double>(lo);
+                double expect = qs[i] > 1.0 ? 0.0 : w == 0.0 ? sorted[lo] : sorted[lo] * (1.0 - w) + sorted[lo + 1] * w;
+                assert_near(many[i], expect, 1e-12);
+                assert_near(quantile(x, qs[i]), expect, 1e-12);
+            }
+        }
+    }
+
+    auto q = quantiles(std::vector<int>{9, 1, 8, 2, 7, 3}, {0.5, 0.2});
+    assert_true(q[0] == 5 && q[1] == 2);
+    std::vector<double> v = {4.0, 1.0, 3.0, 2.0};
+    assert_near(median_in_place(std::span<double>(v)), 2.5, 0.0);
+    assert_near(iqr(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0}), 2.0, 0.0);
+    assert_near(median(std::vector<double>{}), 0.0, 0.0);
+}
+
+TEST(rank_ties) {
+    std::vector<double> x = {3.0, 1.0, 4.0, 1.0, 5.0, 9.0, 2.0, 6.0, 5.0, 3.0, 5.0};
+    std::span<const double> sx(x);
+    auto avg = ranks(sx);
+    auto low = ranks(sx, Ties::min);
+    auto dense = ranks(sx, Ties::dense);
+    std::vector<double> expect_avg = {4.5, 1.5, 6.0, 1.5, 8.0, 11.0, 3.0, 10.0, 8.0, 4.5, 8.0};
+    std::vector<double> expect_min = {4.0, 1.0, 6.0, 1.0, 7.0, 11.0, 3.0, 10.0, 7.0, 4.0, 7.0};
+    std::vector<double> expect_dense = {3.0, 1.0, 4.0, 1.0, 5.0, 7.0, 2.0, 6.0, 5.0, 3.0, 5.0};
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        assert_near(avg[i], expect_avg[i], 0.0);
+        assert_near(low[i], expect_min[i], 0.0);
+        assert_near(dense[i], expect_dense[i], 0.0);
+    }
+
+    // The parallel sort gives the same ranks.
+    std::vector<double> big(50000);
+    for (std::size_t i = 0; i < big.size(); ++i) {
+        big[i] = static_cast<double>((i * 7919) % 1013);
+    }
+    RankScratch<double> scratch;
+    std::vector<double> a(big.size()), b(big.size());
+    rank(std::span<const double>(big), std::span<double>(a), Ties::average, scratch);
+    rank(exec::par.with_grain(3000), std::span<const double>(big), std::span<double>(b), Ties::average, scratch);
+    for (std::size_t i = 0; i < big.size(); ++i) {
+        assert_near(a[i], b[i], 0.0);
+    }
+}
+
+TEST(spearman_and_kendall) {
+    std::vector<double> x = {1.0, 2.0, 2.0, 3.0, 4.0, 4.0, 4.0, 5.0};
+    std::vector<double> y = {2.0, 1.0, 3.0, 3.0, 6.0, 5.0, 5.0, 4.0};
+    // rho = Pearson r of the average ranks, tau-b from the pair counts
+    // (19 concordant, 4 discordant, 4 x ties, 2 y ties of 28 pairs).
+    assert_near(spearman_correlation(x, y), 0.7765323366725411, 1e-14);
+    assert_near(kendall_correlation(x, y), 0.6004805767690767, 1e-14);
+    assert_near(spearman_correlation(x, x), 1.0, 1e-15);
+    assert_near(kendall_correlation(x, std::vector<double>(8, 1.0)), 0.0, 0.0);
+
+    // Against the O(n^2) definition on tie-heavy data, through every
+    // merge level and the parallel sort.
+    std::size_t n = 3001;
+    std::vector<double> u(n), v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        u[i] = static_cast<double>((i * 37) % 101);
+        v[i] = std::round(10.0 * std::sin(0.01 * static_cast<double>(i)) + 0.1 * u[i]);
+    }
+    double concordant = 0.0, discordant = 0.0, tied_u = 0.0, tied_v = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = i + 1; j < n; ++j) {
+            double s = (u[i] - u[j]) * (v[i] - v[j]);
+            concordant += s > 0.0 ? 1.0 : 0.0;
+            discordant += s < 0.0 ? 1.0 : 0.0;
+            tied_u += u[i] == u[j] ? 1.0 : 0.0;
+            tied_v += v[i] == v[j] ? 1.0 : 0.0;
+        }
+    }
+    double pairs = static_cast<double>(n * (n - 1) / 2);
+    double tau = (concordant - discordant) / std::sqrt((pairs - tied_u) * (pairs - tied_v));
+    std::span<const double> su(u), sv(v);
+    RankScratch<double> scratch;
+    assert_near(kendall_tau(su, sv, scratch), tau, 1e-14);
+    assert_near(kendall_tau(exec::par.with_grain(2), su, sv, scratch), tau, 1e-14);
+
+    auto ru = ranks(su);
+    auto rv = ranks(sv);
+    double rho = correlation(ru, rv);
+    assert_near(spearman(su, sv, scratch), rho, 1e-13);
+    assert_near(spearman(exec::par.with_grain(500), su, sv, scratch), rho, 1e-13);
+}
+
 RUN_ALL_TESTS()
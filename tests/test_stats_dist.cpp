@@ -0,0 +1,312 @@
+#include <math/stats/dist/normal.hpp>
+#include <math/stats/dist/gamma.hpp>
+#include <math/stats/dist/beta.hpp>
+#include <math/stats/dist/student_t.hpp>
+#include <math/stats/dist/discrete.hpp>
+#include <math/stats/dist/multivariate_normal.hpp>
+#include <math/random/engine.hpp>
+#include "test_framework.hpp"
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace math;
+using namespace math::test;
+using namespace math::stats::dist;
+
+TEST(normal_values) {
+    Normal<double> d(1.0, 2.0);
+    assert_near(d.pdf(2.5) / 0.1505687160774022, 1.0, 1e-14);
+    assert_near(d.logpdf(2.5), std::log(0.1505687160774022), 1e-14);
+    assert_near(d.cdf(-3.0) / 0.022750131948179207, 1.0, 1e-14);
+    assert_near(d.sf(9.0) / 3.1671241833119921e-5, 1.0, 1e-13);
+    assert_near(d.quantile(d.cdf(-3.0)), -3.0, 1e-13);
+    assert_true(std::isnan(Normal<double>(0.0, -1.0).pdf(0.0)));
+}
+
+TEST(lognormal_values) {
+    LogNormal<double> d(0.5, 0.75);
+    assert_near(d.pdf(2.0) / 0.25728666644678456, 1.0, 1e-14);
+    assert_near(d.cdf(2.0) / 0.60161500591612751, 1.0, 1e-14);
+    assert_near(d.quantile(0.60161500591612751), 2.0, 1e-13);
+    assert_near(d.pdf(-1.0), 0.0, 0.0);
+    assert_near(d.cdf(0.0), 0.0, 0.0);
+    assert_true(std::isinf(d.logpdf(0.0)));
+}
+
+TEST(gamma_values) {
+    Gamma<double> d(2.5, 1.5);
+    assert_near(d.pdf(3.0) / 0.19196788093577974, 1.0, 1e-14);
+    assert_near(d.logpdf(3.0), -1.6504272077411656, 1e-14);
+    assert_near(d.cdf(3.0) / 0.45058404864721977, 1.0, 1e-14);
+    assert_near(d.sf(30.0) / 1.4933679000503952e-7, 1.0, 1e-13);
+    assert_near(d.quantile(0.45058404864721977), 3.0, 1e-12);
+
+    // Large shape, through the cached incomplete-gamma prefix.
+    assert_near(Gamma<double>(200.0).pdf(210.0) / 0.021083359201786393, 1.0, 5e-13);
+
+    ChiSquared<double> chi(3.0);
+    assert_near(chi.cdf(7.8) / 0.94966890214014665, 1.0, 1e-14);
+    assert_near(chi.quantile(0.94966890214014665), 7.8, 1e-11);
+}
+
+TEST(beta_values) {
+    Beta<double> d(2.0, 3.0);
+    assert_near(d.pdf(0.3), 1.764, 1e-14);
+    assert_near(d.cdf(0.3), 0.3483, 1e-15);
+    assert_near(d.sf(0.3), 0.6517, 1e-15);
+    assert_near(d.quantile(0.3483), 0.3, 1e-14);
+    assert_near(d.pdf(0.0), 0.0, 0.0);
+    assert_near(Beta<double>(1.0, 3.0).pdf(0.0), 3.0, 1e-15);
+    assert_true(std::isinf(Beta<double>(0.5, 0.5).pdf(1.0)));
+
+    // Arcsine law: quantile(p) = sin^2(pi p / 2).
+    assert_near(Beta<double>(0.5, 0.5).quantile(0.2), 0.095491502812526288, 1e-15);
+}
+
+TEST(student_t_values) {
+    StudentT<double> d(5.0);
+    assert_near(d.pdf(1.5) / 0.12451734464635514, 1.0, 1e-14);
+    assert_near(d.cdf(1.5), 0.90304815987876328, 1e-15);
+    assert_near(d.cdf(-1.5) / 0.096951840121236716, 1.0, 1e-14);
+    assert_near(d.sf(40.0) / 9.2059810858864772e-8, 1.0, 1e-13);
+    assert_near(d.quantile(0.975), 2.5705818356363155, 1e-13);
+    assert_near(d.quantile(0.025), -2.5705818356363155, 1e-13);
+    assert_near(d.cdf(0.0), 0.5, 0.0);
+
+    // Large nu: the normal limit with its first correction,
+    // pdf(0) = (1 - 1/(4 nu) + ...) / sqrt(2 pi).
+    double nu = 1e10;
+    StudentT<double> wide(nu);
+    double phi0 = 1.0 / std::sqrt(2.0 * std::numbers::pi);
+    assert_near(wide.pdf(0.0) / (phi0 * (1.0 - 0.25 / nu)), 1.0, 1e-14);
+    // The tails go through log B(nu/2, 1/2), cached from the same ratio.
+    assert_near(StudentT<double>(1e8).cdf(1.0), Normal<double>().cdf(1.0), 2e-9);
+
+    // Near the centre for large nu the tail comes from the complementary
+    // I_y(1/2, nu/2) with y = t^2 / (nu + t^2), which does not round.
+    StudentT<double> narrow(1e6);
+    assert_near(narrow.quantile(0.2), -0.84162159301398401207, 1e-14);
+    assert_near(narrow.cdf(narrow.quantile(0.2)), 0.2, 1e-15);
+    assert_near(narrow.cdf(narrow.quantile(0.45)), 0.45, 1e-15);
+
+    // nu = 1 is the Cauchy distribution.
+    StudentT<double> cauchy(1.0);
+    assert_near(cauchy.cdf(1.0), 0.75, 1e-15);
+    assert_near(cauchy.quantile(0.75), 1.0, 1e-14);
+}
+
+TEST(poisson_values) {
+    Poisson<double> d(4.0);
+    assert_near(d.pmf(3.0) / 0.19536681481316459, 1.0, 1e-14);
+    assert_near(d.cdf(5.0) / 0.7851303870304052, 1.0, 1e-14);
+    assert_near(d.cdf(5.5), d.cdf(5.0), 0.0);
+    assert_near(d.sf(5.0), 1.0 - 0.7851303870304052, 1e-15);
+    assert_near(d.pmf(2.5), 0.0, 0.0);
+    assert_near(d.pmf(-1.0), 0.0, 0.0);
+    assert_near(d.quantile(d.cdf(5.0)), 5.0, 0.0);
+    assert_near(d.quantile(0.0), 0.0, 0.0);
+
+    // Saddle-point form stays accurate far from and deep into the tail.
+    Poisson<double> big(1000.0);
+    assert_near(big.pmf(1000.0) / 0.0126146113487215, 1.0, 1e-13);
+    assert_near(big.logpmf(900.0), -9.4957644154119392, 1e-12);
+    assert_near(big.logpmf(40.0) / -834.01042855547191, 1.0, 1e-14);
+    assert_near(big.quantile(big.cdf(1031.0)), 1031.0, 0.0);
+}
+
+TEST(binomial_values) {
+    Binomial<double> d(20, 0.3);
+    assert_near(d.pmf(6.0) / 0.19163898275344258, 1.0, 1e-14);
+    assert_near(d.cdf(6.0) / 0.60800981220092396, 1.0, 1e-14);
+    assert_near(d.sf(10.0) / 0.017144816431258436, 1.0, 1e-13);
+    assert_near(d.pmf(21.0), 0.0, 0.0);
+    assert_near(d.cdf(20.0), 1.0, 0.0);
+    assert_near(d.quantile(d.cdf(6.0)), 6.0, 0.0);
+    assert_near(d.quantile(1.0), 20.0, 0.0);
+
+    double total = 0.0;
+    for (int k = 0; k <= 20; ++k) {
+        total += d.pmf(k);
+    }
+    assert_near(total, 1.0, 1e-14);
+
+    Binomial<double> big(100000, 0.001);
+    assert_near(big.pmf(100.0) / 0.039880942234625597, 1.0, 1e-13);
+    assert_near(big.pmf(0.0) / 3.5385276883434423e-44, 1.0, 1e-12);
+
+    // Large n at p = 1/2: by symmetry cdf(n/2) = 1/2 + pmf(n/2)/2.
+    Binomial<double> wide(1e7, 0.5);
+    assert_near(wide.pmf(5e6) / 0.00025231324589418477862, 1.0, 1e-12);
+    assert_near(wide.cdf(5e6), 0.5 + 0.5 * wide.pmf(5e6), 1e-15);
+    assert_near(wide.cdf(5e6 - 1000.0), 0.26364792810332189887, 1e-13);
+    assert_near(wide.quantile(0.5), 5e6, 0.0);
+    Binomial<double> wider(1e8, 0.5);
+    assert_near(wider.cdf(5e7), 0.5 + 0.5 * wider.pmf(5e7), 1e-15);
+    assert_near(wider.cdf(5e7 - 1000.0), 0.42077939528381405274, 1e-13);
+    assert_near(wider.quantile(0.5), 5e7, 0.0);
+}
+
+TEST(discrete_quantile_upper_tail) {
+    // Far in the upper tail neighbouring counts differ in cdf by less than
+    // the slack a cdf-side tolerance would allow; the answer must still be
+    // the smallest k with sf(k) <= 1 - p.
+    auto check = [](const auto& d) {
+        double k0 = 0.0;
+        while (d.sf(k0) >= 1e-14) {
+            k0 += 1.0;
+        }
+        double p = 1.0 - 0.5 * d.sf(k0);
+        double q = 1.0 - p;
+        double k = d.quantile(p);
+        assert_true(k > k0);
+        assert_true(d.sf(k) <= q);
+        assert_true(d.sf(k - 1.0) > q);
+    };
+    check(Poisson<double>(10.0));
+    check(Binomial<double>(200, 0.1));
+}
+
+TEST(batch_matches_scalar) {
+    std::vector<double> x;
+    for (int i = -20; i <= 60; ++i) {
+        x.push_back(0.25 * i);
+    }
+    x.push_back(std::numeric_limits<double>::infinity());
+    std::vector<double> p;
+    for (int i = 0; i <= 40; ++i) {
+        p.push_back(i / 40.0);
+    }
+    std::vector<double> out(x.size());
+
+    auto check = [&](const auto& d) {
+        auto same = [](double a, double b) {
+            if (std::isnan(b)) {
+                assert_true(std::isnan(a));
+            } else if (std::isinf(b) || b == 0.0) {
+                assert_near(a, b, 0.0);
+            } else {
+                assert_near(a / b, 1.0, 1e-13);
+            }
+        };
+        if constexpr (requires { d.pdf(0.0); }) {
+            d.pdf(x, out);
+            for (std::size_t i = 0; i < x.size(); ++i) same(out[i], d.pdf(x[i]));
+            d.logpdf(x, out);
+            for (std::size_t i = 0; i < x.size(); ++i) same(out[i], d.logpdf(x[i]));
+        } else {
+            d.pmf(x, out);
+            for (std::size_t i = 0; i < x.size(); ++i) same(out[i], d.pmf(x[i]));
+            d.logpmf(x, out);
+            for (std::size_t i = 0; i < x.size(); ++i) same(out[i], d.logpmf(x[i]));
+        }
+        d.cdf(x, out);
+        for (std::size_t i = 0; i < x.size(); ++i) same(out[i], d.cdf(x[i]));
+        d.sf(x, out);
+        for (std::size_t i = 0; i < x.size(); ++i) same(out[i], d.sf(x[i]));
+        d.quantile(p, out);
+        for (std::size_t i = 0; i < p.size(); ++i) same(out[i], d.quantile(p[i]));
+    };
+
+    check(Normal<double>(1.0, 2.0));
+    check(LogNormal<double>(0.5, 0.75));
+    check(Gamma<double>(2.5, 1.5));
+    check(ChiSquared<double>(4.0));
+    check(Beta<double>(2.0, 3.0));
+    check(StudentT<double>(5.0));
+    check(Poisson<double>(4.0));
+    check(Binomial<double>(12, 0.4));
+}
+
+TEST(float_instantiation) {
+    Normal<float> n(0.0f, 1.0f);
+    assert_near(n.cdf(1.0f), 0.8413447460685429f, 1e-6f);
+    Gamma<float> g(2.5f, 1.5f);
+    assert_near(g.cdf(3.0f), 0.45058404864721977f, 1e-6f);
+    StudentT<float> t(5.0f);
+    assert_near(t.quantile(0.975f), 2.5705818356363155f, 1e-4f);
+    Poisson<float> pois(4.0f);
+    assert_near(pois.pmf(3.0f), 0.19536681481316459f, 1e-6f);
+}
+
+TEST(multivariate_normal_density) {
+    Matrix<double, 2, 2> cov;
+    cov(0, 0) = 2.0; cov(0, 1) = 0.6;
+    cov(1, 0) = 0.6; cov(1, 1) = 1.0;
+    MultivariateNormal<double, 2> d(Vector<double, 2>(1.0, -1.0), cov);
+    assert_true(d.valid());
+    assert_near(d.logpdf(Vector<double, 2>(0.5, 0.2)), -3.2590056751322771, 1e-14);
+    assert_near(d.log_determinant(), std::log(2.0 - 0.36), 1e-15);
+
+    // Batch over a count that is not a multiple of the block.
+    Matrix<double, 3, 3> c3;
+    c3(0, 0) = 4.0; c3(0, 1) = 1.0; c3(0, 2) = -0.5;
+    c3(1, 0) = 1.0; c3(1, 1) = 2.0; c3(1, 2) = 0.3;
+    c3(2, 0) = -0.5; c3(2, 1) = 0.3; c3(2, 2) = 1.5;
+    MultivariateNormal<double, 3> d3(Vector<double, 3>(0.5, -1.0, 2.0), c3);
+    std::vector<double> x(3 * 1000);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(0.37 * static_cast<double>(i)) * 3.0;
+    }
+    std::vector<double> lp(1000), p(1000);
+    d3.logpdf(std::span<const double>(x), std::span<double>(lp));
+    d3.pdf(std::span<const double>(x), std::span<double>(p));
+    for (std::size_t s = 0; s < 1000; ++s) {
+        Vector<double, 3> v(x[3 * s], x[3 * s + 1], x[3 * s + 2]);
+        assert_near(lp[s], d3.logpdf(v), 1e-13);
+        assert_near(p[s] / d3.pdf(v), 1.0, 1e-14);
+    }
+
+    c3(2, 2) = -1.0;
+    MultivariateNormal<double, 3> bad(Vector<double, 3>(0.0, 0.0, 0.0), c3);
+    assert_true(!bad.valid());
+    assert_true(std::isnan(bad.logpdf(Vector<double, 3>(0.0, 0.0, 0.0))));
+}
+
+TEST(multivariate_normal_sampling) {
+    Matrix<double, 3, 3> cov;
+    cov(0, 0) = 4.0; cov(0, 1) = 1.0; cov(0, 2) = -0.5;
+    cov(1, 0) = 1.0; cov(1, 1) = 2.0; cov(1, 2) = 0.3;
+    cov(2, 0) = -0.5; cov(2, 1) = 0.3; cov(2, 2) = 1.5;
+    Vector<double, 3> mu(0.5, -1.0, 2.0);
+    MultivariateNormal<double, 3> d(mu, cov);
+
+    constexpr std::size_t n = 200000;
+    std::vector<double> x(3 * n);
+    random::Xoshiro256pp g(17);
+    d.sample(g, std::span<double>(x));
+
+    auto check = [&](const std::vector<double>& xs) {
+        double m[3] = {};
+        for (std::size_t s = 0; s < n; ++s) {
+            for (std::size_t i = 0; i < 3; ++i) {
+                m[i] += xs[3 * s + i] / n;
+            }
+        }
+        for (std::size_t i = 0; i < 3; ++i) {
+            assert_near(m[i], mu[i], 5.0 * std::sqrt(cov(i, i) / n));
+        }
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                double c = 0.0;
+                for (std::size_t s = 0; s < n; ++s) {
+                    c += (xs[3 * s + i] - m[i]) * (xs[3 * s + j] - m[j]);
+                }
+                c /= n;
+                double sd = std::sqrt((cov(i, i) * cov(j, j) + cov(i, j) * cov(i, j)) / n);
+                assert_near(c, cov(i, j), 5.0 * sd);
+            }
+        }
+    };
+    check(x);
+
+    for (std::size_t s = 0; s < n; ++s) {
+        auto v = d.sample(g);
+        for (std::size_t i = 0; i < 3; ++i) {
+            x[3 * s + i] = v[i];
+        }
+    }
+    check(x);
+}
+
+RUN_ALL_TESTS()
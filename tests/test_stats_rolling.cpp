@@ -0,0 +1,130 @@
+#include <math/stats/rolling/window.hpp>
+#include <math/stats/rolling/moments.hpp>
+#include <math/stats/rolling/order.hpp>
+#include <math/stats/descriptive/central.hpp>
+#include <math/stats/descriptive/dispersion.hpp>
+#include <math/exec/thread_pool.hpp>
+#include "test_framework.hpp"
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+using namespace math;
+using namespace math::stats;
+using namespace math::test;
+
+namespace {
+
+// Rough, duplicate-heavy series so ties and plateaus get exercised.
+std::vector<double> series(std::size_t n) {
+    std::vector<double> x(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double t = static_cast<double>(i);
+        x[i] = std::round(8.0 * std::sin(0.37 * t) + 3.0 * std::cos(1.9 * t)) + 0.25 * static_cast<double>(i % 3);
+    }
+    return x;
+}
+
+// The trailing window ending at i, as a vector.
+std::vector<double> window_at(const std::vector<double>& x, std::size_t i, std::size_t w) {
+    std::size_t first = i + 1 >= w ? i + 1 - w : 0;
+    return std::vector<double>(x.begin() + static_cast<std::ptrdiff_t>(first), x.begin() + static_cast<std::ptrdiff_t>(i + 1));
+}
+
+}
+
+TEST(rolling_moments_match_brute_force) {
+    auto x = series(3000);
+    for (std::size_t w : {1u, 2u, 7u, 100u}) {
+        rolling::Mean<double> m(w);
+        rolling::Variance<double> v(w);
+        rolling::Variance<double> vp(w, false);
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            auto win = window_at(x, i, w);
+            assert_near(m.push(x[i]), descriptive::mean(win), 1e-12);
+            assert_near(v.push(x[i]), descriptive::variance(win), 1e-11);
+            assert_near(vp.push(x[i]), descriptive::variance(win, false), 1e-11);
+        }
+    }
+
+    // A large offset with small, alternating steps: the sliding updates
+    // would lose everything to cancellation without compensation.
+    rolling::Variance<double> big(4);
+    rolling::Mean<double> big_mean(4);
+    double value = 0.0;
+    for (int i = 0; i < 100000; ++i) {
+        double v = 1e9 + static_cast<double>(i % 4);
+        value = big.push(v);
+        big_mean.push(v);
+    }
+    assert_near(value, 5.0 / 3.0, 1e-6);
+    assert_near(big_mean.value(), 1e9 + 1.5, 1e-6);
+}
+
+TEST(rolling_order_statistics_match_brute_force) {
+    auto x = series(2500);
+    for (std::size_t w : {1u, 2u, 5u, 64u, 301u}) {
+        rolling::Min<double> lo(w);
+        rolling::Max<double> hi(w);
+        rolling::Quantile<double> med(w);
+        rolling::Quantile<double> p90(w, 0.9);
+        rolling::Quantile<double> p0(w, 0.0);
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            auto win = window_at(x, i, w);
+            assert_near(lo.push(x[i]), *std::min_element(win.begin(), win.end()), 0.0);
+            assert_near(hi.push(x[i]), *std::max_element(win.begin(), win.end()), 0.0);
+            assert_near(med.push(x[i]), descriptive::median(win), 1e-12);
+            assert_near(p90.push(x[i]), descriptive::quantile(win, 0.9), 1e-12);
+            assert_near(p0.push(x[i]), *std::min_element(win.begin(), win.end()), 0.0);
+        }
+    }
+}
+
+TEST(rolling_ewm) {
+    rolling::EwmMean<double> m(0.5);
+    rolling::EwmVariance<double> v(0.5);
+    std::vector<double> x = {2.0, 4.0, 4.0, 0.0};
+    std::vector<double> mean_out(4), var_out(4);
+    rolling::apply(m, std::span<const double>(x), std::span<double>(mean_out));
+    rolling::apply(v, std::span<const double>(x), std::span<double>(var_out));
+    // m: 2, 3, 3.5, 1.75; v: 0, 1, 0.75, 3.4375.
+    assert_near(mean_out[1], 3.0, 0.0);
+    assert_near(mean_out[3], 1.75, 0.0);
+    assert_near(var_out[0], 0.0, 0.0);
+    assert_near(var_out[1], 1.0, 0.0);
+    assert_near(var_out[2], 0.75, 0.0);
+    assert_near(var_out[3], 3.4375, 1e-15);
+    assert_near(v.mean(), m.value(), 0.0);
+
+    // A constant input settles to its value with zero variance.
+    rolling::EwmVariance<double> c(0.1);
+    for (int i = 0; i < 50; ++i) {
+        c.push(7.0);
+    }
+    assert_near(c.value(), 0.0, 0.0);
+    assert_near(c.mean(), 7.0, 0.0);
+}
+
+TEST(rolling_apply_across_series) {
+    constexpr std::size_t length = 1000;
+    constexpr std::size_t count = 9;
+    auto x = series(length * count);
+    std::vector<double> seq(x.size()), par(x.size());
+    rolling::Quantile<double> proto(50, 0.75);
+    rolling::apply(exec::seq, proto, std::span<const double>(x), length, std::span<double>(seq));
+    exec::ThreadPool pool(3);
+    rolling::apply(exec::par.with_grain(1).on(pool), proto, std::span<const double>(x), length, std::span<double>(par));
+    for (std::size_t s = 0; s < count; ++s) {
+        // Each series starts from a fresh window.
+        rolling::Quantile<double> fresh(50, 0.75);
+        for (std::size_t i = 0; i < length; ++i) {
+            std::size_t k = s * length + i;
+            double expect = fresh.push(x[k]);
+            assert_near(seq[k], expect, 0.0);
+            assert_near(par[k], expect, 0.0);
+        }
+    }
+}
+
+RUN_ALL_TESTS()
@@ -0,0 +1,219 @@
+#include <math/stats/sketch/tdigest.hpp>
+#include <math/stats/sketch/kll.hpp>
+#include <math/random/engine.hpp>
+#include <math/random/ziggurat.hpp>
+#include "test_framework.hpp"
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+using namespace math;
+using namespace math::stats::sketch;
+using namespace math::test;
+
+namespace {
+
+std::vector<double> exponential_sample(std::size_t n, std::uint64_t seed) {
+    random::Xoshiro256pp g(seed);
+    std::vector<double> x(n);
+    random::exponential(g, std::span<double>(x));
+    return x;
+}
+
+// Exact fraction of the (sorted) sample that is <= v.
+double true_cdf(const std::vector<double>& sorted, double v) {
+    auto it = std::upper_bound(sorted.begin(), sorted.end(), v);
+    return static_cast<double>(it - sorted.begin()) / static_cast<double>(sorted.size());
+}
+
+const std::vector<double> probes = {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+
+}
+
+TEST(tdigest_accuracy) {
+    auto x = exponential_sample(1000000, 1);
+    TDigest<double> d;
+    d.push(std::span<const double>(x));
+    std::sort(x.begin(), x.end());
+
+    assert_true(d.count() == x.size());
+    assert_true(d.centroids().size() <= 100);
+    assert_near(d.quantile(0.0), x.front(), 0.0);
+    assert_near(d.quantile(1.0), x.back(), 0.0);
+    for (double q : probes) {
+        assert_near(true_cdf(x, d.quantile(q)), q, d.rank_error(q));
+        double v = x[static_cast<std::size_t>(q * static_cast<double>(x.size()))];
+        assert_near(d.cdf(v), q, d.rank_error(q) + 1e-6);
+    }
+    assert_true(std::isnan(d.quantile(1.5)));
+    assert_true(std::isnan(TDigest<double>().quantile(0.5)));
+}
+
+TEST(tdigest_merge_and_bytes) {
+    auto x = exponential_sample(400000, 2);
+    std::span<const double> all(x);
+    TDigest<double> whole;
+    whole.push(all);
+
+    // Per-thread digests of uneven shards, one fed value by value.
+    TDigest<double> a, b, c;
+    a.push(all.subspan(0, 1000));
+    for (double v : all.subspan(1000, 99000)) {
+        b.push(v);
+    }
+    c.push(all.subspan(100000));
+    a.merge(b);
+    a.merge(TDigest<double>());
+    a.merge(c);
+    assert_true(a.count() == whole.count());
+    assert_true(a.centroids().size() <= 100);
+    std::sort(x.begin(), x.end());
+    for (double q : probes) {
+        assert_near(true_cdf(x, a.quantile(q)), q, a.rank_error(q));
+    }
+
+    auto bytes = a.serialize();
+    auto back = TDigest<double>::deserialize(bytes);
+    assert_true(back.has_value());
+    assert_true(back->count() == a.count());
+    for (double q : probes) {
+        assert_near(back->quantile(q), a.quantile(q), 0.0);
+    }
+    assert_true(!TDigest<double>::deserialize(std::span<const std::byte>(bytes).first(bytes.size() - 1)));
+
+    // Merging from a const digest with values still buffered matches
+    // merging its folded copy, and leaves the source as it was.
+    TDigest<double> src;
+    src.push(all.subspan(0, 100));
+    const TDigest<double>& shared = src;
+    TDigest<double> folded = src;
+    folded.centroids();
+    TDigest<double> left, right;
+    left.merge(shared);
+    right.merge(folded);
+    assert_true(left.count() == 100 && src.count() == 100);
+    for (double q : probes) {
+        assert_near(left.quantile(q), right.quantile(q), 0.0);
+    }
+    assert_true(!TDigest<float>::deserialize(bytes));
+    assert_true(!KllSketch<double>::deserialize(bytes));
+}
+
+TEST(kll_accuracy_bound) {
+    auto x = exponential_sample(1000000, 3);
+    KllSketch<double> s(200, 7);
+    s.push(std::span<const double>(x));
+    std::sort(x.begin(), x.end());
+
+    assert_true(s.count() == x.size());
+    assert_true(s.retained() < 3 * 200 + 64);
+    double eps = s.rank_error(0.9999);
+    assert_true(eps > 0.0 && eps < 0.05);
+    assert_near(s.quantile(0.0), x.front(), 0.0);
+    assert_near(s.quantile(1.0), x.back(), 0.0);
+    std::vector<double> est(probes.size());
+    s.quantiles(std::span<const double>(probes), std::span<double>(est));
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+        double q = probes[i];
+        assert_near(true_cdf(x, est[i]), q, eps + 1e-6);
+        assert_near(est[i], s.quantile(q), 0.0);
+        double v = x[static_cast<std::size_t>(q * static_cast<double>(x.size()))];
+        assert_near(s.cdf(v), true_cdf(x, v), eps);
+    }
+
+    // Nothing compacted yet: exact.
+    KllSketch<int> small;
+    for (int v = 100; v > 0; --v) {
+        small.push(v);
+    }
+    assert_true(small.rank(37) == 37 && small.rank_error() == 0.0);
+    assert_true(small.quantile(0.5) == 50);
+}
+
+TEST(kll_merge_and_bytes) {
+    auto x = exponential_sample(300000, 4);
+    std::span<const double> all(x);
+    std::vector<KllSketch<double>> parts;
+    for (std::size_t i = 0; i < 6; ++i) {
+        parts.emplace_back(200, i);
+        parts.back().push(all.subspan(i * 50000, 50000));
+    }
+    KllSketch<double> merged(200, 99);
+    for (const auto& p : parts) {
+        merged.merge(p);
+    }
+    assert_true(merged.count() == x.size());
+    assert_true(merged.retained() < 3 * 200 + 64);
+    std::sort(x.begin(), x.end());
+    double eps = merged.rank_error(0.9999);
+    for (double q : probes) {
+        assert_near(true_cdf(x, merged.quantile(q)), q, eps + 1e-6);
+    }
+
+    auto bytes = merged.serialize();
+    auto back = KllSketch<double>::deserialize(bytes);
+    assert_true(back.has_value());
+    assert_true(back->count() == merged.count() && back->retained() == merged.retained());
+    assert_near(back->rank_error(), merged.rank_error(), 0.0);
+    for (double q : probes) {
+        assert_near(back->quantile(q), merged.quantile(q), 0.0);
+    }
+    // Both continue identically, coin included.
+    merged.push(all.subspan(0, 5000));
+    back->push(all.subspan(0, 5000));
+    assert_near(back->quantile(0.3), merged.quantile(0.3), 0.0);
+
+    // clear() restarts the compaction coin from the constructor's seed,
+    // also after a round trip through bytes.
+    KllSketch<double> fresh(200, 99);
+    fresh.push(all.subspan(0, 20000));
+    back->clear();
+    back->push(all.subspan(0, 20000));
+    merged.clear();
+    merged.push(all.subspan(0, 20000));
+    assert_true(merged.retained() == fresh.retained() && back->retained() == fresh.retained());
+    for (double q : probes) {
+        assert_near(merged.quantile(q), fresh.quantile(q), 0.0);
+        assert_near(back->quantile(q), fresh.quantile(q), 0.0);
+    }
+
+    bytes[bytes.size() / 2] = std::byte{0xff};
+    bytes.resize(bytes.size() - 3);
+    assert_true(!KllSketch<double>::deserialize(bytes));
+}
+
+TEST(sketch_self_merge) {
+    auto x = exponential_sample(100000, 8);
+    KllSketch<double> s(200, 5);
+    s.push(std::span<const double>(x));
+    KllSketch<double> expect = s;
+    expect.merge(KllSketch<double>(s));
+    s.merge(s);
+    assert_true(s.count() == 2 * x.size() && s.count() == expect.count());
+    assert_true(s.retained() == expect.retained());
+    assert_true(s.rank(s.max()) == s.count());
+    std::sort(x.begin(), x.end());
+    double eps = s.rank_error(0.9999);
+    for (double q : probes) {
+        assert_near(s.quantile(q), expect.quantile(q), 0.0);
+        assert_near(true_cdf(x, s.quantile(q)), q, eps + 1e-6);
+    }
+
+    // Nothing compacted: every value is held twice.
+    KllSketch<int> small;
+    for (int v = 1; v <= 10; ++v) {
+        small.push(v);
+    }
+    small.merge(small);
+    assert_true(small.count() == 20 && small.rank(5) == 10);
+
+    TDigest<double> t;
+    t.push(std::span<const double>(x));
+    double median = t.quantile(0.5);
+    t.merge(t);
+    assert_true(t.count() == 2 * x.size());
+    assert_near(t.quantile(0.5), median, 1e-2);
+}
+
+RUN_ALL_TESTS()
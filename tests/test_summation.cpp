@@ -0,0 +1,103 @@
+#include <math/core/summation.hpp>
+#include <math/core/vector.hpp>
+#include "test_framework.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace math;
+using namespace math::test;
+
+TEST(sum_policies_agree_on_exact_data) {
+    std::vector<double> data(1000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<double>(i);
+    }
+    std::span<const double> s(data);
+    assert_true(summation::sum(s, summation::naive) == 499500.0);
+    assert_true(summation::sum(s) == 499500.0);
+    assert_true(summation::sum(s, summation::neumaier) == 499500.0);
+    assert_true(summation::sum(s, summation::dot2) == 499500.0);
+}
+
+TEST(sum_empty) {
+    std::span<const double> s;
+    assert_true(summation::sum(s) == 0.0);
+    assert_true(summation::sum(s, summation::neumaier) == 0.0);
+}
+
+TEST(pairwise_beats_naive) {
+    std::vector<float> data(1 << 20, 0.1f);
+    std::span<const float> s(data);
+    double exact = static_cast<double>(0.1f) * static_cast<double>(data.size());
+    double naive_err = std::abs(summation::sum(s, summation::naive) - exact) / exact;
+    double pairwise_err = std::abs(summation::sum(s, summation::pairwise) - exact) / exact;
+    double neumaier_err = std::abs(summation::sum(s, summation::neumaier) - exact) / exact;
+    assert_true(naive_err > 1e-3);
+    assert_true(pairwise_err < 1e-6);
+    assert_true(neumaier_err < 1e-7);
+}
+
+TEST(neumaier_cancellation) {
+    std::vector<double> data;
+    for (int k = 0; k < 50; ++k) {
+        data.push_back(1.0);
+        data.push_back(1e100);
+        data.push_back(1.0);
+        data.push_back(-1e100);
+    }
+    std::span<const double> s(data);
+    assert_near(summation::sum(s, summation::neumaier), 100.0, 1e-12);
+    assert_true(summation::sum(s, summation::naive) != 100.0);
+}
+
+TEST(dot2_recovers_product_error) {
+    double x = 1.0 + std::ldexp(1.0, -30);
+    std::vector<double> a = {x, -1.0};
+    std::vector<double> b = {x, 1.0 + std::ldexp(1.0, -29)};
+    std::span<const double> sa(a), sb(b);
+    assert_true(summation::dot(sa, sb, summation::neumaier) == 0.0);
+    assert_true(summation::dot(sa, sb, summation::dot2) == std::ldexp(1.0, -60));
+}
+
+TEST(compensated_infinities) {
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> up = {1.0, inf, 2.0};
+    std::vector<double> down = {1.0, -inf, 2.0};
+    std::vector<double> both = {inf, 1.0, -inf};
+    std::vector<double> ones = {1.0, 1.0, 1.0};
+    std::vector<double> huge = {1e300, 1.0, 1.0};
+    std::span<const double> u(up), d(down), o(ones), h(huge);
+    assert_true(summation::sum(u, summation::neumaier) == inf);
+    assert_true(summation::sum(d, summation::neumaier) == -inf);
+    assert_true(std::isnan(summation::sum(std::span<const double>(both), summation::neumaier)));
+    assert_true(summation::dot(u, o, summation::dot2) == inf);
+    assert_true(summation::dot(d, o, summation::dot2) == -inf);
+    // 1e300^2 overflows; the product's fma residual must not make it NaN.
+    assert_true(summation::dot(h, h, summation::dot2) == inf);
+}
+
+TEST(transform_defaults_to_pairwise) {
+    std::vector<float> data(1 << 20, 0.1f);
+    auto f = [&data](std::size_t i) { return data[i]; };
+    auto one = [](std::size_t) { return 1.0f; };
+    float expect = summation::sum(std::span<const float>(data));
+    assert_true(summation::transform_sum<float>(0, data.size(), f) == expect);
+    assert_true(summation::transform_dot<float>(0, data.size(), f, one) == expect);
+}
+
+TEST(integral_sum) {
+    std::vector<int> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::span<const int> s(data);
+    assert_true(summation::sum(s) == 55);
+    assert_true(summation::dot(s, s, summation::dot2) == 385);
+}
+
+TEST(vector_dot_summation) {
+    Vector<double, 3> a{1e16, 1.0, -1e16};
+    Vector<double, 3> b{1.0, 1.0, 1.0};
+    assert_near(dot(a, b, summation::neumaier), 1.0, 1e-15);
+    assert_near(dot(a, b, summation::dot2), 1.0, 1e-15);
+}
+
+RUN_ALL_TESTS()
@@ -1,6 +1,11 @@
 #include <math/core/vector.hpp>
 #include "test_framework.hpp"
 
+// The core types must not depend on math::exec.
+#if defined(MATH_EXEC_POLICY_HPP) || defined(MATH_EXEC_REDUCE_HPP) || defined(MATH_EXEC_PARALLEL_HPP) || defined(MATH_EXEC_THREAD_POOL_HPP)
+#error "core/vector.hpp includes math::exec headers"
+#endif
+
 using namespace math;
 using namespace math::test;
 